@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        BinaryFetchStream.cpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#include <ISOBMFF.hpp>
+#include <XSTest/XSTest.hpp>
+#include "ExampleFiles.hpp"
+#include "CountingFetch.hpp"
+
+XSTest( ISOBMFF_BinaryFetchStream, CachedBlocks )
+{
+    CountingFetch                fetch( ExampleFile( "IMG1.HEIC" ) );
+    ISOBMFF::BinaryFetchStream   stream( fetch.Size(), fetch, 1024, 8 );
+    uint8_t                      buf[ 100 ];
+    
+    stream.ReadAt( 5000, buf, sizeof( buf ) );
+    
+    XSTestAssertEqual( fetch.Count(), 1U );
+    XSTestAssertEqual( fetch.Bytes(), 1024U );
+    
+    stream.ReadAt( 5020, buf, sizeof( buf ) );
+    stream.ReadAt( 4096, buf, sizeof( buf ) );
+    
+    XSTestAssertEqual( fetch.Count(), 1U );
+}
+
+XSTest( ISOBMFF_BinaryFetchStream, AdjacentMisses )
+{
+    CountingFetch                fetch( ExampleFile( "IMG1.HEIC" ) );
+    ISOBMFF::BinaryFetchStream   stream( fetch.Size(), fetch, 1024, 8 );
+    std::vector< uint8_t >       data( 3000 );
+    std::vector< uint8_t >       file( ExampleFileData( "IMG1.HEIC" ) );
+    
+    /* Blocks 9 to 12 */
+    stream.ReadAt( 10000, data.data(), data.size() );
+    
+    XSTestAssertEqual( fetch.Count(), 1U );
+    XSTestAssertEqual( fetch.Bytes(), 4096U );
+    XSTestAssertTrue( std::equal( data.begin(), data.end(), file.begin() + 10000 ) );
+}
+
+XSTest( ISOBMFF_BinaryFetchStream, SequentialPrefetch )
+{
+    CountingFetch                fetch( ExampleFile( "IMG1.HEIC" ) );
+    ISOBMFF::BinaryFetchStream   stream( fetch.Size(), fetch, 1024, 8 );
+    std::vector< uint8_t >       file( ExampleFileData( "IMG1.HEIC" ) );
+    std::vector< uint8_t >       data( 512 );
+    size_t                       i;
+    
+    /* The next block is fetched along, so only every other block is requested */
+    for( i = 0; i < 8; i++ )
+    {
+        stream.Read( data.data(), data.size() );
+        
+        XSTestAssertTrue( std::equal( data.begin(), data.end(), file.begin() + static_cast< std::ptrdiff_t >( i * data.size() ) ) );
+    }
+    
+    XSTestAssertEqual( stream.Tell(), 4096U );
+    XSTestAssertEqual( fetch.Count(), 2U );
+}
+
+XSTest( ISOBMFF_BinaryFetchStream, LargeReadBypassesCache )
+{
+    CountingFetch                fetch( ExampleFile( "IMG1.HEIC" ) );
+    ISOBMFF::BinaryFetchStream   stream( fetch.Size(), fetch, 1024, 4 );
+    std::vector< uint8_t >       data( 8192 );
+    
+    stream.ReadAt( 100, data.data(), data.size() );
+    
+    XSTestAssertEqual( fetch.Count(), 1U );
+    XSTestAssertEqual( fetch.Bytes(), 8192U );
+}
+
+XSTest( ISOBMFF_BinaryFetchStream, ParseMetadataOnly )
+{
+    CountingFetch                                 fetch( ExampleFile( "IMG1.HEIC" ) );
+    std::shared_ptr< ISOBMFF::BinaryFetchStream > stream( std::make_shared< ISOBMFF::BinaryFetchStream >( fetch.Size(), fetch ) );
+    ISOBMFF::Parser                               fetched;
+    ISOBMFF::Parser                               local;
+    
+    fetched.Parse( stream );
+    local.Parse( ExampleFile( "IMG1.HEIC" ) );
+    
+    XSTestAssertNotEqual( fetched.GetFile(), nullptr );
+    XSTestAssertEqual( fetched.GetFile()->GetBoxes().size(), local.GetFile()->GetBoxes().size() );
+    XSTestAssertEqual
+    (
+        fetched.GetFile()->GetTypedBox< ISOBMFF::META >( "meta" )->GetTypedBox< ISOBMFF::ILOC >( "iloc" )->GetItems().size(),
+        local.GetFile()->GetTypedBox< ISOBMFF::META >( "meta" )->GetTypedBox< ISOBMFF::ILOC >( "iloc" )->GetItems().size()
+    );
+    
+    /* MDAT data is read on demand, so most of the file is never fetched */
+    XSTestAssertGreater( fetch.Count(), 0U );
+    XSTestAssertLess( fetch.Bytes(), fetch.Size() / 4 );
+}
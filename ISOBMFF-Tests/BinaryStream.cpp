@@ -0,0 +1,213 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        BinaryStream.cpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#include <ISOBMFF.hpp>
+#include <XSTest/XSTest.hpp>
+#include <cstring>
+
+/* Stream implementing only the methods required before Size() and ReadAt() */
+class MinimalStream: public ISOBMFF::BinaryStream
+{
+    public:
+        
+        MinimalStream( const std::vector< uint8_t > & data ):
+            _data( data ),
+            _pos( 0 )
+        {}
+        
+        void Read( uint8_t * buf, size_t size ) override
+        {
+            if( size > this->_data.size() - this->_pos )
+            {
+                throw std::runtime_error( "Not enough data" );
+            }
+            
+            memcpy( buf, this->_data.data() + this->_pos, size );
+            
+            this->_pos += size;
+        }
+        
+        size_t Tell() const override
+        {
+            return this->_pos;
+        }
+        
+        void Seek( std::streamoff offset, SeekDirection dir ) override
+        {
+            switch( dir )
+            {
+                case SeekDirection::Begin:   this->_pos  = static_cast< size_t >( offset ); break;
+                case SeekDirection::Current: this->_pos += static_cast< size_t >( offset ); break;
+                case SeekDirection::End:     this->_pos  = this->_data.size() + static_cast< size_t >( offset ); break;
+            }
+        }
+        
+    private:
+        
+        std::vector< uint8_t > _data;
+        size_t                 _pos;
+};
+
+XSTest( ISOBMFF_BinaryStream, DefaultSize )
+{
+    MinimalStream stream( { 1, 2, 3, 4, 5, 6 } );
+    
+    stream.Seek( 2, ISOBMFF::BinaryStream::SeekDirection::Begin );
+    
+    XSTestAssertEqual( stream.Size(), 6U );
+    XSTestAssertEqual( stream.Tell(), 2U );
+    XSTestAssertEqual( stream.AvailableBytes(), 4U );
+    XSTestAssertTrue( stream.HasBytesAvailable() );
+    
+    stream.Seek( 0, ISOBMFF::BinaryStream::SeekDirection::End );
+    
+    XSTestAssertEqual( stream.AvailableBytes(), 0U );
+    XSTestAssertFalse( stream.HasBytesAvailable() );
+}
+
+XSTest( ISOBMFF_BinaryStream, DefaultReadAt )
+{
+    MinimalStream stream( { 1, 2, 3, 4, 5, 6 } );
+    uint8_t       buf[ 3 ] = { 0, 0, 0 };
+    
+    stream.Seek( 1, ISOBMFF::BinaryStream::SeekDirection::Begin );
+    stream.ReadAt( 3, buf, sizeof( buf ) );
+    
+    XSTestAssertEqual( buf[ 0 ], 4 );
+    XSTestAssertEqual( buf[ 1 ], 5 );
+    XSTestAssertEqual( buf[ 2 ], 6 );
+    XSTestAssertEqual( stream.Tell(), 1U );
+    XSTestAssertEqual( stream.ReadUInt8(), 2 );
+}
+
+XSTest( ISOBMFF_BinaryStream, DefaultReadAtFailure )
+{
+    MinimalStream stream( { 1, 2, 3, 4 } );
+    uint8_t       buf[ 3 ] = { 0, 0, 0 };
+    
+    stream.Seek( 1, ISOBMFF::BinaryStream::SeekDirection::Begin );
+    
+    XSTestAssertThrow( stream.ReadAt( 2, buf, sizeof( buf ) ), std::runtime_error );
+    XSTestAssertEqual( stream.Tell(), 1U );
+}
+
+XSTest( ISOBMFF_BinaryStream, ReadMatrix )
+{
+    std::vector< uint8_t > data;
+    uint32_t               i;
+    
+    for( i = 1; i <= 9; i++ )
+    {
+        data.insert( data.end(), { static_cast< uint8_t >( i ), 0x02, 0x03, 0x04 } );
+    }
+    
+    data.push_back( 0xFF );
+    
+    {
+        MinimalStream   stream( data );
+        ISOBMFF::Matrix matrix( stream.ReadMatrix() );
+        
+        XSTestAssertEqual( matrix.GetA(), 0x01020304U );
+        XSTestAssertEqual( matrix.GetB(), 0x02020304U );
+        XSTestAssertEqual( matrix.GetU(), 0x03020304U );
+        XSTestAssertEqual( matrix.GetC(), 0x04020304U );
+        XSTestAssertEqual( matrix.GetD(), 0x05020304U );
+        XSTestAssertEqual( matrix.GetV(), 0x06020304U );
+        XSTestAssertEqual( matrix.GetX(), 0x07020304U );
+        XSTestAssertEqual( matrix.GetY(), 0x08020304U );
+        XSTestAssertEqual( matrix.GetW(), 0x09020304U );
+        XSTestAssertEqual( stream.Tell(), 36U );
+        XSTestAssertEqual( stream.ReadUInt8(), 0xFF );
+    }
+}
+
+XSTest( ISOBMFF_BinaryStream, ReadBigEndianArrays )
+{
+    std::vector< uint8_t > data;
+    uint16_t               u16[ 37 ];
+    uint32_t               u32[ 37 ];
+    uint64_t               u64[ 37 ];
+    size_t                 i;
+    
+    /* Odd counts, so the values don't fill whole vectors */
+    for( i = 0; i < 37 * 8; i++ )
+    {
+        data.push_back( static_cast< uint8_t >( i ) );
+    }
+    
+    {
+        ISOBMFF::BinaryDataStream stream( data );
+        
+        stream.ReadBigEndianUInt16Array( u16, 37 );
+        
+        XSTestAssertEqual( stream.Tell(), 37U * 2 );
+        
+        for( i = 0; i < 37; i++ )
+        {
+            XSTestAssertEqual( u16[ i ], ( data[ i * 2 ] << 8 ) | data[ i * 2 + 1 ] );
+        }
+    }
+    
+    {
+        MinimalStream stream( data );
+        
+        stream.ReadBigEndianUInt32Array( u32, 37 );
+        
+        XSTestAssertEqual( stream.Tell(), 37U * 4 );
+        
+        for( i = 0; i < 37; i++ )
+        {
+            stream.Seek( static_cast< std::streamoff >( i * 4 ), ISOBMFF::BinaryStream::SeekDirection::Begin );
+            
+            XSTestAssertEqual( u32[ i ], stream.ReadBigEndianUInt32() );
+        }
+    }
+    
+    {
+        ISOBMFF::BinaryDataStream stream( data );
+        
+        stream.ReadBigEndianUInt64Array( u64, 37 );
+        
+        XSTestAssertEqual( stream.Tell(), 37U * 8 );
+        
+        for( i = 0; i < 37; i++ )
+        {
+            stream.Seek( static_cast< std::streamoff >( i * 8 ), ISOBMFF::BinaryStream::SeekDirection::Begin );
+            
+            XSTestAssertEqual( u64[ i ], stream.ReadBigEndianUInt64() );
+        }
+    }
+    
+    {
+        ISOBMFF::BinaryDataStream stream( data );
+        
+        XSTestAssertThrow( stream.ReadBigEndianUInt64Array( u64, 38 ), std::runtime_error );
+    }
+}
@@ -0,0 +1,236 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        BoxLayout.cpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#include <ISOBMFF.hpp>
+#include <XSTest/XSTest.hpp>
+#include "ExampleFiles.hpp"
+#include "TestBoxes.hpp"
+
+static ISOBMFF::BoxLayout Scan( const std::vector< uint8_t > & data )
+{
+    ISOBMFF::BinaryDataStream stream( data );
+    
+    return ISOBMFF::BoxLayout( stream );
+}
+
+static void CheckEntry( const ISOBMFF::BoxLayout::Entry & entry, const std::string & type, uint64_t offset, uint64_t size, uint32_t headerSize, uint32_t depth, bool truncated )
+{
+    XSTestAssertTrue( entry.GetType() == ISOBMFF::FourCC( type ) );
+    XSTestAssertEqual( entry.GetOffset(),     offset );
+    XSTestAssertEqual( entry.GetSize(),       size );
+    XSTestAssertEqual( entry.GetHeaderSize(), headerSize );
+    XSTestAssertEqual( entry.GetDepth(),      depth );
+    XSTestAssertEqual( entry.IsTruncated(),   truncated );
+}
+
+XSTest( ISOBMFF_BoxLayout, LargeSize )
+{
+    std::vector< uint8_t > data( MakeFTYPBox() );
+    
+    AppendData( data, MakeLargeBox( "free", std::vector< uint8_t >( 10, 0 ) ) );
+    AppendData( data, MakeLargeBox( "moov", MakeBox( "free", {} ) ) );
+    
+    ISOBMFF::BoxLayout layout( Scan( data ) );
+    
+    XSTestAssertFalse( layout.IsTruncated() );
+    XSTestAssertEqual( layout.GetEntries().size(), 4U );
+    
+    CheckEntry( layout.GetEntries()[ 0 ], "ftyp",  0, 20,  8, 0, false );
+    CheckEntry( layout.GetEntries()[ 1 ], "free", 20, 26, 16, 0, false );
+    CheckEntry( layout.GetEntries()[ 2 ], "moov", 46, 24, 16, 0, false );
+    CheckEntry( layout.GetEntries()[ 3 ], "free", 62,  8,  8, 1, false );
+}
+
+XSTest( ISOBMFF_BoxLayout, OpenEndedBox )
+{
+    std::vector< uint8_t > data( MakeFTYPBox() );
+    
+    /* A size of 0 extends to the end of the file, only at the top level */
+    AppendData( data, MakeBox( "moov", 0, MakeBox( "free", 0, std::vector< uint8_t >( 4, 0 ) ) ) );
+    
+    ISOBMFF::BoxLayout layout( Scan( data ) );
+    
+    XSTestAssertEqual( layout.GetEntries().size(), 3U );
+    
+    CheckEntry( layout.GetEntries()[ 0 ], "ftyp",  0, 20, 8, 0, false );
+    CheckEntry( layout.GetEntries()[ 1 ], "moov", 20, 20, 8, 0, false );
+    CheckEntry( layout.GetEntries()[ 2 ], "free", 28,  0, 8, 1, true );
+    
+    XSTestAssertTrue( layout.IsTruncated() );
+}
+
+XSTest( ISOBMFF_BoxLayout, UUID )
+{
+    std::vector< uint8_t > uuid( 16, 0xAA );
+    std::vector< uint8_t > content( uuid );
+    std::vector< uint8_t > data;
+    
+    AppendData( content, { 1, 2, 3, 4 } );
+    AppendData( data, MakeBox( "uuid", content ) );
+    AppendData( data, MakeLargeBox( "uuid", content ) );
+    
+    ISOBMFF::BoxLayout layout( Scan( data ) );
+    
+    XSTestAssertFalse( layout.IsTruncated() );
+    XSTestAssertEqual( layout.GetEntries().size(), 2U );
+    
+    CheckEntry( layout.GetEntries()[ 0 ], "uuid",  0, 28, 24, 0, false );
+    CheckEntry( layout.GetEntries()[ 1 ], "uuid", 28, 36, 32, 0, false );
+}
+
+XSTest( ISOBMFF_BoxLayout, Truncated )
+{
+    {
+        std::vector< uint8_t > data( MakeFTYPBox() );
+        
+        AppendData( data, MakeBox( "mdat", 100, std::vector< uint8_t >( 10, 0 ) ) );
+        
+        ISOBMFF::BoxLayout layout( Scan( data ) );
+        
+        XSTestAssertTrue( layout.IsTruncated() );
+        XSTestAssertEqual( layout.GetEntries().size(), 2U );
+        
+        CheckEntry( layout.GetEntries()[ 1 ], "mdat", 20, 100, 8, 0, true );
+    }
+    
+    {
+        std::vector< uint8_t > data( MakeFTYPBox() );
+        
+        /* Too small for a box header */
+        AppendData( data, { 0, 0, 0, 8 } );
+        
+        ISOBMFF::BoxLayout layout( Scan( data ) );
+        
+        XSTestAssertTrue( layout.IsTruncated() );
+        XSTestAssertEqual( layout.GetEntries().size(), 1U );
+    }
+    
+    {
+        std::vector< uint8_t > data( MakeFTYPBox() );
+        
+        /* Missing the 64-bits size */
+        AppendData( data, MakeBox( "free", 1, { 0, 0 } ) );
+        
+        ISOBMFF::BoxLayout layout( Scan( data ) );
+        
+        XSTestAssertTrue( layout.IsTruncated() );
+        XSTestAssertEqual( layout.GetEntries().size(), 2U );
+        
+        CheckEntry( layout.GetEntries()[ 1 ], "free", 20, 1, 16, 0, true );
+    }
+    
+    {
+        std::vector< uint8_t > data;
+        
+        /* Child box past the end of its container */
+        AppendData( data, MakeBox( "moov", MakeBox( "free", 100, {} ) ) );
+        AppendData( data, MakeBox( "free", {} ) );
+        
+        ISOBMFF::BoxLayout layout( Scan( data ) );
+        
+        XSTestAssertEqual( layout.GetEntries().size(), 3U );
+        
+        CheckEntry( layout.GetEntries()[ 0 ], "moov",  0,  16, 8, 0, false );
+        CheckEntry( layout.GetEntries()[ 1 ], "free",  8, 100, 8, 1, true );
+        CheckEntry( layout.GetEntries()[ 2 ], "free", 16,   8, 8, 0, false );
+        
+        XSTestAssertTrue( layout.IsTruncated() );
+    }
+}
+
+XSTest( ISOBMFF_BoxLayout, IINFChildBoxesOffset )
+{
+    std::vector< uint8_t > infe( MakeBox( "infe", { 2, 0, 0, 0, 0, 1, 0, 0, 'h', 'v', 'c', '1', 0 } ) );
+    std::vector< uint8_t > iinf0( { 0, 0, 0, 0, 0, 1 } );
+    std::vector< uint8_t > iinf1( { 1, 0, 0, 0, 0, 0, 0, 1 } );
+    std::vector< uint8_t > meta( { 0, 0, 0, 0 } );
+    
+    /* Version 0 has a 16-bits entry count, version 1 a 32-bits one */
+    AppendData( iinf0, infe );
+    AppendData( iinf1, infe );
+    AppendData( meta, MakeBox( "iinf", iinf0 ) );
+    AppendData( meta, MakeBox( "iinf", iinf1 ) );
+    
+    ISOBMFF::BoxLayout layout( Scan( MakeBox( "meta", meta ) ) );
+    
+    XSTestAssertFalse( layout.IsTruncated() );
+    XSTestAssertEqual( layout.GetEntries().size(), 5U );
+    
+    CheckEntry( layout.GetEntries()[ 0 ], "meta",  0, 84, 8, 0, false );
+    CheckEntry( layout.GetEntries()[ 1 ], "iinf", 12, 35, 8, 1, false );
+    CheckEntry( layout.GetEntries()[ 2 ], "infe", 26, 21, 8, 2, false );
+    CheckEntry( layout.GetEntries()[ 3 ], "iinf", 47, 37, 8, 1, false );
+    CheckEntry( layout.GetEntries()[ 4 ], "infe", 63, 21, 8, 2, false );
+}
+
+XSTest( ISOBMFF_BoxLayout, QuickTimeMeta )
+{
+    std::vector< uint8_t > hdlr( MakeBox( "hdlr", std::vector< uint8_t >( 25, 0 ) ) );
+    std::vector< uint8_t > data;
+    std::vector< uint8_t > meta( { 0, 0, 0, 0 } );
+    
+    /* QuickTime meta boxes are not full boxes */
+    AppendData( data, MakeBox( "meta", hdlr ) );
+    AppendData( meta, hdlr );
+    AppendData( data, MakeBox( "meta", meta ) );
+    
+    ISOBMFF::BoxLayout layout( Scan( data ) );
+    
+    XSTestAssertFalse( layout.IsTruncated() );
+    XSTestAssertEqual( layout.GetEntries().size(), 4U );
+    
+    CheckEntry( layout.GetEntries()[ 0 ], "meta",  0, 41, 8, 0, false );
+    CheckEntry( layout.GetEntries()[ 1 ], "hdlr",  8, 33, 8, 1, false );
+    CheckEntry( layout.GetEntries()[ 2 ], "meta", 41, 45, 8, 0, false );
+    CheckEntry( layout.GetEntries()[ 3 ], "hdlr", 53, 33, 8, 1, false );
+}
+
+XSTest( ISOBMFF_BoxLayout, ExampleFiles )
+{
+    for( const auto & name: { "IMG1.HEIC", "MOV1.MOV" } )
+    {
+        ISOBMFF::Parser    parser( ExampleFile( name ) );
+        ISOBMFF::BoxLayout layout( ExampleFile( name ) );
+        size_t             count( 0 );
+        
+        for( const auto & entry: layout.GetEntries() )
+        {
+            if( entry.GetDepth() == 0 )
+            {
+                XSTestAssertTrue( entry.GetType() == parser.GetFile()->GetBoxes()[ count ]->GetType() );
+                
+                count++;
+            }
+        }
+        
+        XSTestAssertFalse( layout.IsTruncated() );
+        XSTestAssertEqual( count, parser.GetFile()->GetBoxes().size() );
+    }
+}
@@ -0,0 +1,226 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        BoxVisitor.cpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#include <ISOBMFF.hpp>
+#include <XSTest/XSTest.hpp>
+#include "ExampleFiles.hpp"
+#include "TestBoxes.hpp"
+#include <typeinfo>
+
+/* Records the visited boxes, optionally skipping a box type */
+class RecordingVisitor: public ISOBMFF::BoxVisitor
+{
+    public:
+        
+        RecordingVisitor( ISOBMFF::FourCC skip = ISOBMFF::FourCC() ):
+            _skip( skip ),
+            _balanced( true ),
+            _tkhd( 0 ),
+            _ispe( 0 )
+        {}
+        
+        bool OnBoxBegin( ISOBMFF::FourCC type, uint64_t offset, uint64_t size, uint32_t depth ) override
+        {
+            if( depth != this->_open.size() )
+            {
+                this->_balanced = false;
+            }
+            
+            this->_begins.emplace_back( type, offset, size, 0, depth, false );
+            this->_open.push_back( type );
+            
+            return type != this->_skip;
+        }
+        
+        void OnBoxEnd( ISOBMFF::FourCC type, uint32_t depth ) override
+        {
+            if( this->_open.size() == 0 || this->_open.back() != type || depth + 1 != this->_open.size() )
+            {
+                this->_balanced = false;
+            }
+            else
+            {
+                this->_open.pop_back();
+            }
+        }
+        
+        void OnBox( const ISOBMFF::Box & box ) override
+        {
+            this->_boxes.push_back( box.GetType() );
+            
+            if( typeid( box ) == typeid( ISOBMFF::Box ) )
+            {
+                this->_untyped.push_back( box.GetType() );
+            }
+            
+            ISOBMFF::BoxVisitor::OnBox( box );
+        }
+        
+        void OnTKHD( const ISOBMFF::TKHD & ) override
+        {
+            this->_tkhd++;
+        }
+        
+        void OnISPE( const ISOBMFF::ISPE & ) override
+        {
+            this->_ispe++;
+        }
+        
+        ISOBMFF::FourCC                          _skip;
+        std::vector< ISOBMFF::BoxLayout::Entry > _begins;
+        std::vector< ISOBMFF::FourCC >           _open;
+        std::vector< ISOBMFF::FourCC >           _boxes;
+        std::vector< ISOBMFF::FourCC >           _untyped;
+        bool                                     _balanced;
+        size_t                                   _tkhd;
+        size_t                                   _ispe;
+};
+
+XSTest( ISOBMFF_BoxVisitor, BeginEndBalance )
+{
+    for( const auto & name: { "IMG1.HEIC", "IMG2.HEIC", "MOV1.MOV" } )
+    {
+        RecordingVisitor   visitor;
+        ISOBMFF::Parser    parser;
+        ISOBMFF::BoxLayout layout( ExampleFile( name ) );
+        
+        parser.Visit( ExampleFile( name ), visitor );
+        
+        XSTestAssertTrue( visitor._balanced );
+        XSTestAssertEqual( visitor._open.size(), 0U );
+        XSTestAssertEqual( visitor._begins.size(), layout.GetEntries().size() );
+        
+        /* Same boxes as the layout scanner, at the same offsets and depths */
+        for( size_t i = 0; i < visitor._begins.size(); i++ )
+        {
+            XSTestAssertTrue(  visitor._begins[ i ].GetType() == layout.GetEntries()[ i ].GetType() );
+            XSTestAssertEqual( visitor._begins[ i ].GetOffset(), layout.GetEntries()[ i ].GetOffset() );
+            XSTestAssertEqual( visitor._begins[ i ].GetSize(),   layout.GetEntries()[ i ].GetSize() );
+            XSTestAssertEqual( visitor._begins[ i ].GetDepth(),  layout.GetEntries()[ i ].GetDepth() );
+        }
+        
+        XSTestAssertEqual( parser.GetFile(), nullptr );
+    }
+}
+
+XSTest( ISOBMFF_BoxVisitor, TypedCallbacks )
+{
+    {
+        RecordingVisitor visitor;
+        
+        ISOBMFF::Parser().Visit( ExampleFile( "MOV1.MOV" ), visitor );
+        
+        XSTestAssertEqual( visitor._tkhd, 4U );
+        XSTestAssertEqual( visitor._ispe, 0U );
+    }
+    
+    {
+        RecordingVisitor visitor;
+        
+        ISOBMFF::Parser().Visit( ExampleFile( "IMG1.HEIC" ), visitor );
+        
+        XSTestAssertEqual( visitor._tkhd, 0U );
+        XSTestAssertEqual( visitor._ispe, 3U );
+    }
+}
+
+XSTest( ISOBMFF_BoxVisitor, SkipSubtree )
+{
+    RecordingVisitor                         visitor( ISOBMFF::FourCC( "trak" ) );
+    ISOBMFF::BoxLayout                       layout( ExampleFile( "MOV1.MOV" ) );
+    std::vector< ISOBMFF::BoxLayout::Entry > expected;
+    uint64_t                                 end( 0 );
+    
+    ISOBMFF::Parser().Visit( ExampleFile( "MOV1.MOV" ), visitor );
+    
+    /* All boxes except the ones inside tracks */
+    for( const auto & entry: layout.GetEntries() )
+    {
+        if( entry.GetOffset() < end )
+        {
+            continue;
+        }
+        
+        if( entry.GetType() == ISOBMFF::FourCC( "trak" ) )
+        {
+            end = entry.GetOffset() + entry.GetSize();
+        }
+        
+        expected.push_back( entry );
+    }
+    
+    XSTestAssertTrue( visitor._balanced );
+    XSTestAssertEqual( visitor._open.size(), 0U );
+    XSTestAssertEqual( visitor._tkhd, 0U );
+    XSTestAssertLess( expected.size(), layout.GetEntries().size() );
+    XSTestAssertEqual( visitor._begins.size(), expected.size() );
+    
+    for( size_t i = 0; i < expected.size(); i++ )
+    {
+        XSTestAssertTrue(  visitor._begins[ i ].GetType() == expected[ i ].GetType() );
+        XSTestAssertEqual( visitor._begins[ i ].GetOffset(), expected[ i ].GetOffset() );
+    }
+    
+    /* Skipped boxes are not decoded */
+    for( const auto & type: visitor._boxes )
+    {
+        XSTestAssertTrue( type != ISOBMFF::FourCC( "trak" ) );
+    }
+}
+
+XSTest( ISOBMFF_BoxVisitor, UnregisteredBoxes )
+{
+    std::vector< uint8_t > data( MakeFTYPBox() );
+    
+    AppendData( data, MakeBox( "zzzz", { 1, 2, 3, 4 } ) );
+    AppendData( data, MakeBox( "moov", MakeBox( "yyyy", {} ) ) );
+    
+    {
+        RecordingVisitor          visitor;
+        ISOBMFF::BinaryDataStream stream( data );
+        
+        ISOBMFF::Parser().Visit( stream, visitor );
+        
+        XSTestAssertEqual( visitor._begins.size(), 4U );
+        XSTestAssertEqual( visitor._boxes.size(), 2U );
+        XSTestAssertTrue( visitor._boxes[ 0 ] == ISOBMFF::FourCC( "ftyp" ) );
+        XSTestAssertTrue( visitor._boxes[ 1 ] == ISOBMFF::FourCC( "moov" ) );
+    }
+    
+    for( const auto & name: { "IMG1.HEIC", "IMG2.HEIC", "MOV1.MOV" } )
+    {
+        RecordingVisitor visitor;
+        
+        ISOBMFF::Parser().Visit( ExampleFile( name ), visitor );
+        
+        XSTestAssertGreater( visitor._boxes.size(), 0U );
+        XSTestAssertEqual( visitor._untyped.size(), 0U );
+    }
+}
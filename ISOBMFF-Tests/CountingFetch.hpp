@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        CountingFetch.hpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#ifndef ISOBMFF_TESTS_COUNTING_FETCH_HPP
+#define ISOBMFF_TESTS_COUNTING_FETCH_HPP
+
+#include <string>
+#include <memory>
+#include <fstream>
+#include <stdexcept>
+#include <cstdint>
+
+/*!
+ * @class       CountingFetch
+ * @abstract    File-backed fetch function for BinaryFetchStream, counting
+ *              the requests.
+ * @discussion  Copies share the file and the counters.
+ */
+class CountingFetch
+{
+    public:
+        
+        CountingFetch( const std::string & path ):
+            _file( std::make_shared< std::ifstream >( path, std::ios::binary ) ),
+            _count( std::make_shared< size_t >( 0 ) ),
+            _bytes( std::make_shared< size_t >( 0 ) )
+        {
+            this->_file->seekg( 0, std::ios::end );
+            
+            this->_size = static_cast< uint64_t >( this->_file->tellg() );
+        }
+        
+        void operator ()( uint64_t offset, uint8_t * buf, size_t size ) const
+        {
+            this->_file->seekg( static_cast< std::streamoff >( offset ), std::ios::beg );
+            this->_file->read( reinterpret_cast< char * >( buf ), static_cast< std::streamsize >( size ) );
+            
+            if( this->_file->fail() )
+            {
+                throw std::runtime_error( "Cannot read file" );
+            }
+            
+            ( *( this->_count ) )++;
+            ( *( this->_bytes ) ) += size;
+        }
+        
+        uint64_t Size()  const { return this->_size; }
+        size_t   Count() const { return *( this->_count ); }
+        size_t   Bytes() const { return *( this->_bytes ); }
+        
+    private:
+        
+        std::shared_ptr< std::ifstream > _file;
+        std::shared_ptr< size_t >        _count;
+        std::shared_ptr< size_t >        _bytes;
+        uint64_t                         _size;
+};
+
+#endif /* ISOBMFF_TESTS_COUNTING_FETCH_HPP */
@@ -0,0 +1,68 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ExampleFiles.hpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#ifndef ISOBMFF_TESTS_EXAMPLE_FILES_HPP
+#define ISOBMFF_TESTS_EXAMPLE_FILES_HPP
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iterator>
+#include <cstdint>
+
+/*!
+ * @function    ExampleFile
+ * @abstract    Gets the path of a file from the Example-Files directory.
+ * @param       name    The file name.
+ * @result      The file path, relative to the tests' source directory.
+ */
+inline std::string ExampleFile( const std::string & name )
+{
+    std::string dir( __FILE__ );
+    
+    dir = dir.substr( 0, dir.find_last_of( "/\\" ) + 1 );
+    
+    return dir + "../Example-Files/" + name;
+}
+
+/*!
+ * @function    ExampleFileData
+ * @abstract    Reads a file from the Example-Files directory.
+ * @param       name    The file name.
+ * @result      The file data.
+ */
+inline std::vector< uint8_t > ExampleFileData( const std::string & name )
+{
+    std::ifstream stream( ExampleFile( name ), std::ios::binary );
+    
+    return std::vector< uint8_t >( std::istreambuf_iterator< char >( stream ), std::istreambuf_iterator< char >() );
+}
+
+#endif /* ISOBMFF_TESTS_EXAMPLE_FILES_HPP */
@@ -0,0 +1,168 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        FlatFile.cpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#include <ISOBMFF.hpp>
+#include <XSTest/XSTest.hpp>
+#include "ExampleFiles.hpp"
+#include "TestBoxes.hpp"
+#include <tuple>
+
+/* Expected type, parent and depth of each node, in file order */
+static void FlattenBoxes( const ISOBMFF::Container & container, uint32_t parent, uint32_t depth, std::vector< std::tuple< ISOBMFF::FourCC, uint32_t, uint32_t > > & nodes )
+{
+    for( const auto & box: container.GetBoxes() )
+    {
+        uint32_t index( static_cast< uint32_t >( nodes.size() ) );
+        
+        nodes.push_back( std::make_tuple( box->GetType(), parent, depth ) );
+        
+        auto children( std::dynamic_pointer_cast< ISOBMFF::Container >( box ) );
+        
+        if( children != nullptr )
+        {
+            FlattenBoxes( *( children ), index, depth + 1, nodes );
+        }
+    }
+}
+
+XSTest( ISOBMFF_FlatFile, NodesMatchFile )
+{
+    for( const auto & name: { "IMG1.HEIC", "IMG2.HEIC", "MOV1.MOV" } )
+    {
+        std::vector< std::tuple< ISOBMFF::FourCC, uint32_t, uint32_t > > expected;
+        ISOBMFF::Parser                                                  parser;
+        
+        parser.AddOption( ISOBMFF::Parser::Options::SkipMDATData );
+        parser.Parse( ExampleFile( name ) );
+        FlattenBoxes( *( parser.GetFile() ), ISOBMFF::FlatFile::NoNode, 0, expected );
+        
+        ISOBMFF::FlatFile flat( ExampleFile( name ) );
+        const auto &      nodes( flat.GetNodes() );
+        uint64_t          offset( 0 );
+        
+        XSTestAssertEqual( nodes.size(), expected.size() );
+        
+        for( uint32_t i = 0; i < nodes.size(); i++ )
+        {
+            uint32_t next;
+            
+            XSTestAssertTrue(  nodes[ i ].GetType() == std::get< 0 >( expected[ i ] ) );
+            XSTestAssertEqual( nodes[ i ].GetParent(), std::get< 1 >( expected[ i ] ) );
+            XSTestAssertEqual( nodes[ i ].GetDepth(),  std::get< 2 >( expected[ i ] ) );
+            
+            /* The first child directly follows its parent */
+            if( i + 1 < nodes.size() && nodes[ i + 1 ].GetParent() == i )
+            {
+                XSTestAssertEqual( nodes[ i ].GetFirstChild(), i + 1 );
+            }
+            else
+            {
+                XSTestAssertEqual( nodes[ i ].GetFirstChild(), ISOBMFF::FlatFile::NoNode );
+            }
+            
+            /* The next sibling is the next node with the same parent, before any node of a lower depth */
+            for( next = i + 1; next < nodes.size() && nodes[ next ].GetDepth() > nodes[ i ].GetDepth(); next++ )
+            {}
+            
+            if( next < nodes.size() && nodes[ next ].GetParent() == nodes[ i ].GetParent() )
+            {
+                XSTestAssertEqual( nodes[ i ].GetNextSibling(), next );
+                XSTestAssertEqual( nodes[ next ].GetOffset(), nodes[ i ].GetOffset() + nodes[ i ].GetSize() );
+            }
+            else
+            {
+                XSTestAssertEqual( nodes[ i ].GetNextSibling(), ISOBMFF::FlatFile::NoNode );
+            }
+            
+            if( nodes[ i ].GetDepth() == 0 )
+            {
+                XSTestAssertEqual( nodes[ i ].GetOffset(), offset );
+                
+                offset += nodes[ i ].GetSize();
+            }
+        }
+    }
+}
+
+XSTest( ISOBMFF_FlatFile, FindNodes )
+{
+    ISOBMFF::FlatFile flat( ExampleFile( "MOV1.MOV" ) );
+    
+    auto tkhd( flat.FindNodes( "trak/tkhd" ) );
+    
+    XSTestAssertEqual( tkhd.size(), 4U );
+    XSTestAssertTrue( tkhd == flat.FindNodes( ISOBMFF::FourCC( "tkhd" ) ) );
+    XSTestAssertEqual( flat.FindNodes( "moov/trak/tkhd" ).size(), 4U );
+    XSTestAssertEqual( flat.FindNodes( "moov/tkhd" ).size(), 0U );
+    
+    for( uint32_t index: tkhd )
+    {
+        XSTestAssertTrue( flat.GetNodes()[ flat.GetNodes()[ index ].GetParent() ].GetType() == ISOBMFF::FourCC( "trak" ) );
+        XSTestAssertNotEqual( flat.GetTypedBox< ISOBMFF::TKHD >( index ), nullptr );
+    }
+}
+
+XSTest( ISOBMFF_FlatFile, GetBoxes )
+{
+    ISOBMFF::FlatFile flat( ExampleFile( "IMG1.HEIC" ) );
+    
+    auto ispe( flat.GetTypedBoxes< ISOBMFF::ISPE >( ISOBMFF::FourCC( "ispe" ) ) );
+    auto nodes( flat.FindNodes( ISOBMFF::FourCC( "ispe" ) ) );
+    
+    XSTestAssertEqual( ispe.size(), 3U );
+    XSTestAssertEqual( flat.GetBoxes( ISOBMFF::FourCC( "ispe" ) ).size(), 3U );
+    XSTestAssertEqual( nodes.size(), 3U );
+    
+    for( size_t i = 0; i < nodes.size(); i++ )
+    {
+        XSTestAssertEqual( flat.GetNodes()[ nodes[ i ] ].GetBoxIndex(), i );
+        XSTestAssertEqual( flat.GetBox( nodes[ i ] ), ispe[ i ] );
+        XSTestAssertGreater( ispe[ i ]->GetDisplayWidth(), 0U );
+        XSTestAssertGreater( ispe[ i ]->GetDisplayHeight(), 0U );
+    }
+    
+    /* Containers are only nodes */
+    XSTestAssertEqual( flat.GetBoxes( ISOBMFF::FourCC( "ipco" ) ).size(), 0U );
+    XSTestAssertEqual( flat.GetBox( flat.FindNodes( ISOBMFF::FourCC( "ipco" ) )[ 0 ] ), nullptr );
+}
+
+XSTest( ISOBMFF_FlatFile, ParseFailure )
+{
+    /* The mvhd box only has its version and flags */
+    std::vector< uint8_t >    data( MakeBox( "moov", MakeBox( "mvhd", { 0, 0, 0, 0 } ) ) );
+    ISOBMFF::BinaryDataStream stream( data );
+    ISOBMFF::FlatFile         flat( ExampleFile( "IMG1.HEIC" ) );
+    
+    XSTestAssertGreater( flat.GetNodes().size(), 0U );
+    XSTestAssertAnyThrow( flat.Parse( ISOBMFF::Parser(), stream ) );
+    XSTestAssertEqual( flat.GetNodes().size(), 0U );
+    XSTestAssertEqual( flat.GetBoxes( ISOBMFF::FourCC( "ispe" ) ).size(), 0U );
+    XSTestAssertEqual( flat.FindNodes( "moov/mvhd" ).size(), 0U );
+}
@@ -0,0 +1,213 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        IncrementalParser.cpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#include <ISOBMFF.hpp>
+#include <XSTest/XSTest.hpp>
+#include "ExampleFiles.hpp"
+#include "TestBoxes.hpp"
+#include <algorithm>
+
+/* Feeds data in chunks, and returns the parsed top-level boxes */
+static std::vector< std::shared_ptr< ISOBMFF::Box > > FeedChunks( const ISOBMFF::Parser & parser, const std::vector< uint8_t > & data, size_t chunkSize )
+{
+    std::vector< std::shared_ptr< ISOBMFF::Box > > boxes;
+    size_t                                         i;
+    
+    ISOBMFF::IncrementalParser incremental
+    (
+        parser,
+        [ & ]( const std::shared_ptr< ISOBMFF::Box > & box )
+        {
+            boxes.push_back( box );
+        }
+    );
+    
+    for( i = 0; i < data.size(); i += chunkSize )
+    {
+        incremental.Feed( data.data() + i, std::min( chunkSize, data.size() - i ) );
+    }
+    
+    incremental.Finish();
+    
+    return boxes;
+}
+
+XSTest( ISOBMFF_IncrementalParser, ChunkBoundaries )
+{
+    for( const auto & name: { "IMG1.HEIC", "MOV1.MOV" } )
+    {
+        std::vector< uint8_t > data( ExampleFileData( name ) );
+        ISOBMFF::Parser        parser;
+        ISOBMFF::Parser        eager;
+        
+        parser.AddOption( ISOBMFF::Parser::Options::SkipMDATData );
+        eager.AddOption( ISOBMFF::Parser::Options::SkipMDATData );
+        eager.Parse( data );
+        
+        auto expected( eager.GetFile()->GetBoxes() );
+        
+        for( size_t chunkSize: { size_t( 1 ), size_t( 3 ), size_t( 8 ), size_t( 4095 ), data.size() } )
+        {
+            auto boxes( FeedChunks( parser, data, chunkSize ) );
+            
+            XSTestAssertEqual( boxes.size(), expected.size() );
+            
+            for( size_t i = 0; i < boxes.size(); i++ )
+            {
+                XSTestAssertEqual( boxes[ i ]->GetType(), expected[ i ]->GetType() );
+                XSTestAssertEqual( boxes[ i ]->ToString(), expected[ i ]->ToString() );
+            }
+        }
+    }
+}
+
+XSTest( ISOBMFF_IncrementalParser, LargeSize )
+{
+    std::vector< uint8_t > data( MakeFTYPBox() );
+    std::vector< uint8_t > content( 10, 0xAB );
+    
+    AppendData( data, MakeLargeBox( "free", content ) );
+    AppendData( data, MakeBox( "free", {} ) );
+    
+    for( size_t chunkSize: { size_t( 1 ), size_t( 5 ), data.size() } )
+    {
+        auto boxes( FeedChunks( ISOBMFF::Parser(), data, chunkSize ) );
+        
+        XSTestAssertEqual( boxes.size(), 3U );
+        XSTestAssertEqual( boxes[ 0 ]->GetName(), "ftyp" );
+        XSTestAssertEqual( boxes[ 1 ]->GetName(), "free" );
+        XSTestAssertTrue( boxes[ 1 ]->GetData() == content );
+        XSTestAssertEqual( boxes[ 2 ]->GetName(), "free" );
+        XSTestAssertEqual( boxes[ 2 ]->GetData().size(), 0U );
+    }
+}
+
+XSTest( ISOBMFF_IncrementalParser, OpenEndedBox )
+{
+    std::vector< uint8_t >                         data( MakeFTYPBox() );
+    std::vector< uint8_t >                         content( 100, 0xCD );
+    std::vector< std::shared_ptr< ISOBMFF::Box > > boxes;
+    size_t                                         i;
+    
+    /* A size of 0 extends to the end of the stream */
+    AppendData( data, MakeBox( "mdat", 0, content ) );
+    
+    ISOBMFF::IncrementalParser incremental
+    (
+        [ & ]( const std::shared_ptr< ISOBMFF::Box > & box )
+        {
+            boxes.push_back( box );
+        }
+    );
+    
+    for( i = 0; i < data.size(); i++ )
+    {
+        incremental.Feed( data.data() + i, 1 );
+    }
+    
+    XSTestAssertEqual( incremental.GetOffset(), data.size() );
+    XSTestAssertEqual( boxes.size(), 1U );
+    
+    incremental.Finish();
+    
+    XSTestAssertEqual( boxes.size(), 2U );
+    
+    auto mdat( std::dynamic_pointer_cast< ISOBMFF::MDAT >( boxes[ 1 ] ) );
+    
+    XSTestAssertNotEqual( mdat, nullptr );
+    XSTestAssertEqual( mdat->GetDataOffset(), MakeFTYPBox().size() + 8 );
+    XSTestAssertEqual( mdat->GetDataLength(), content.size() );
+    XSTestAssertTrue( mdat->GetData() == content );
+    XSTestAssertEqual( incremental.GetOffset(), 0U );
+}
+
+XSTest( ISOBMFF_IncrementalParser, SkippedMDATIsNotBuffered )
+{
+    std::vector< uint8_t >                         data( MakeFTYPBox() );
+    std::vector< std::shared_ptr< ISOBMFF::Box > > boxes;
+    ISOBMFF::Parser                                parser;
+    
+    AppendData( data, MakeBox( "mdat", std::vector< uint8_t >( 1000, 0 ) ) );
+    parser.AddOption( ISOBMFF::Parser::Options::SkipMDATData );
+    
+    ISOBMFF::IncrementalParser incremental
+    (
+        parser,
+        [ & ]( const std::shared_ptr< ISOBMFF::Box > & box )
+        {
+            boxes.push_back( box );
+        }
+    );
+    
+    incremental.Feed( data.data(), data.size() - 1 );
+    
+    XSTestAssertEqual( boxes.size(), 1U );
+    XSTestAssertLessOrEqual( incremental.GetBufferedSize(), 8U );
+    
+    incremental.Feed( data.data() + data.size() - 1, 1 );
+    
+    XSTestAssertEqual( boxes.size(), 2U );
+    XSTestAssertEqual( std::dynamic_pointer_cast< ISOBMFF::MDAT >( boxes[ 1 ] )->GetDataLength(), 1000U );
+}
+
+XSTest( ISOBMFF_IncrementalParser, IncompleteBox )
+{
+    std::vector< uint8_t >                         data( MakeFTYPBox() );
+    std::vector< std::shared_ptr< ISOBMFF::Box > > boxes;
+    
+    ISOBMFF::IncrementalParser incremental
+    (
+        [ & ]( const std::shared_ptr< ISOBMFF::Box > & box )
+        {
+            boxes.push_back( box );
+        }
+    );
+    
+    incremental.Feed( data.data(), data.size() - 1 );
+    
+    XSTestAssertThrow( incremental.Finish(), std::runtime_error );
+    XSTestAssertEqual( boxes.size(), 0U );
+    
+    /* The parser is reset, and can parse a new stream */
+    incremental.Feed( data.data(), data.size() );
+    incremental.Finish();
+    
+    XSTestAssertEqual( boxes.size(), 1U );
+}
+
+XSTest( ISOBMFF_IncrementalParser, InvalidSize )
+{
+    std::vector< uint8_t >     data;
+    ISOBMFF::IncrementalParser incremental( nullptr );
+    
+    AppendData( data, MakeBox( "free", 4, {} ) );
+    
+    XSTestAssertThrow( incremental.Feed( data.data(), data.size() ), std::runtime_error );
+}
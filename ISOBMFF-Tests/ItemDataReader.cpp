@@ -0,0 +1,200 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ItemDataReader.cpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#include <ISOBMFF.hpp>
+#include <XSTest/XSTest.hpp>
+#include "ExampleFiles.hpp"
+#include "TestBoxes.hpp"
+
+static void AppendILOCItem( std::vector< uint8_t > & data, uint16_t itemID, uint16_t constructionMethod, const std::vector< std::vector< uint32_t > > & extents )
+{
+    AppendUInt16( data, itemID );
+    AppendUInt16( data, constructionMethod );
+    AppendUInt16( data, 0 );
+    AppendUInt16( data, static_cast< uint16_t >( extents.size() ) );
+    
+    /* Index, offset and length */
+    for( const auto & extent: extents )
+    {
+        AppendUInt32( data, extent[ 0 ] );
+        AppendUInt32( data, extent[ 1 ] );
+        AppendUInt32( data, extent[ 2 ] );
+    }
+}
+
+/*
+ * Creates a file with a mdat box containing "ABCDEFGHIJKLMNOP", at
+ * offset 28, and a meta box with an idat box containing "0123456789".
+ * Item 1 is "ABCD" + "IJKL", from the file.
+ * Item 2 is "234", from the idat box.
+ * Item 3 is "BCDIJ" from item 1 + item 2.
+ * Item 4 is "ABCD" + "EFGH", from the file.
+ */
+static std::vector< uint8_t > ItemsFileData()
+{
+    std::vector< uint8_t > data;
+    std::vector< uint8_t > meta;
+    std::vector< uint8_t > iloc;
+    std::vector< uint8_t > iref;
+    std::string            mdat( "ABCDEFGHIJKLMNOP" );
+    std::string            idat( "0123456789" );
+    
+    /* Version 1, offset and length sizes 4, index size 4 */
+    iloc = { 1, 0, 0, 0, 0x44, 0x04 };
+    
+    AppendUInt16( iloc, 4 );
+    AppendILOCItem( iloc, 1, 0, { { 0, 28, 4 }, { 0, 36, 4 } } );
+    AppendILOCItem( iloc, 2, 1, { { 0, 2, 3 } } );
+    AppendILOCItem( iloc, 3, 2, { { 1, 1, 5 }, { 2, 0, 0 } } );
+    AppendILOCItem( iloc, 4, 0, { { 0, 28, 4 }, { 0, 32, 4 } } );
+    
+    iref = { 0, 0, 0, 0 };
+    
+    {
+        std::vector< uint8_t > reference;
+        
+        AppendUInt16( reference, 3 );
+        AppendUInt16( reference, 2 );
+        AppendUInt16( reference, 1 );
+        AppendUInt16( reference, 2 );
+        
+        AppendData( iref, MakeBox( "iloc", reference ) );
+    }
+    
+    meta = { 0, 0, 0, 0 };
+    
+    AppendData( meta, MakeBox( "iloc", iloc ) );
+    AppendData( meta, MakeBox( "idat", std::vector< uint8_t >( idat.begin(), idat.end() ) ) );
+    AppendData( meta, MakeBox( "iref", iref ) );
+    
+    AppendData( data, MakeFTYPBox() );
+    AppendData( data, MakeBox( "mdat", std::vector< uint8_t >( mdat.begin(), mdat.end() ) ) );
+    AppendData( data, MakeBox( "meta", meta ) );
+    
+    return data;
+}
+
+static std::string ItemString( const ISOBMFF::ItemDataReader & reader, uint32_t itemID )
+{
+    std::vector< uint8_t > data( reader.GetData( itemID ) );
+    
+    return std::string( data.begin(), data.end() );
+}
+
+XSTest( ISOBMFF_ItemDataReader, ConstructionMethods )
+{
+    std::vector< uint8_t >                        data( ItemsFileData() );
+    ISOBMFF::Parser                               parser;
+    std::vector< ISOBMFF::ItemDataReader::Range > ranges;
+    
+    parser.Parse( data );
+    
+    ISOBMFF::ItemDataReader reader( *( parser.GetFile() ), std::make_shared< ISOBMFF::BinaryDataStream >( data ) );
+    
+    XSTestAssertTrue(  reader.HasItem( 1 ) );
+    XSTestAssertFalse( reader.HasItem( 5 ) );
+    
+    /* Construction method 0 */
+    ranges = reader.GetRanges( 1 );
+    
+    XSTestAssertEqual( ranges.size(), 2U );
+    XSTestAssertTrue(  ranges[ 0 ].GetSource() == ISOBMFF::ItemDataReader::Source::File );
+    XSTestAssertEqual( ranges[ 0 ].GetOffset(), 28U );
+    XSTestAssertEqual( ranges[ 1 ].GetOffset(), 36U );
+    XSTestAssertEqual( reader.GetSize( 1 ), 8U );
+    XSTestAssertEqual( ItemString( reader, 1 ), "ABCDIJKL" );
+    
+    /* Construction method 1 */
+    ranges = reader.GetRanges( 2 );
+    
+    XSTestAssertEqual( ranges.size(), 1U );
+    XSTestAssertTrue(  ranges[ 0 ].GetSource() == ISOBMFF::ItemDataReader::Source::IDAT );
+    XSTestAssertEqual( ranges[ 0 ].GetOffset(), 2U );
+    XSTestAssertEqual( ranges[ 0 ].GetLength(), 3U );
+    XSTestAssertEqual( ItemString( reader, 2 ), "234" );
+    
+    /* Construction method 2 */
+    ranges = reader.GetRanges( 3 );
+    
+    XSTestAssertEqual( ranges.size(), 3U );
+    XSTestAssertEqual( ranges[ 0 ].GetOffset(), 29U );
+    XSTestAssertEqual( ranges[ 0 ].GetLength(), 3U );
+    XSTestAssertEqual( ranges[ 1 ].GetOffset(), 36U );
+    XSTestAssertEqual( ranges[ 1 ].GetLength(), 2U );
+    XSTestAssertTrue(  ranges[ 2 ].GetSource() == ISOBMFF::ItemDataReader::Source::IDAT );
+    XSTestAssertEqual( ItemString( reader, 3 ), "BCDIJ234" );
+    
+    /* Contiguous extents are merged */
+    ranges = reader.GetRanges( 4 );
+    
+    XSTestAssertEqual( ranges.size(), 1U );
+    XSTestAssertEqual( ranges[ 0 ].GetLength(), 8U );
+    XSTestAssertEqual( ItemString( reader, 4 ), "ABCDEFGH" );
+    
+    XSTestAssertThrow( reader.GetData( 5 ), std::runtime_error );
+}
+
+XSTest( ISOBMFF_ItemDataReader, DataView )
+{
+    std::vector< uint8_t > data( ItemsFileData() );
+    ISOBMFF::Parser        parser;
+    
+    parser.Parse( data );
+    
+    ISOBMFF::ItemDataReader reader( *( parser.GetFile() ), std::make_shared< ISOBMFF::BinaryDataStream >( data ) );
+    
+    for( uint32_t id: { 1, 2, 3, 4 } )
+    {
+        ISOBMFF::DataView view( reader.GetDataView( id ) );
+        
+        XSTestAssertEqual( std::string( view.GetBytes(), view.GetBytes() + view.GetSize() ), ItemString( reader, id ) );
+    }
+}
+
+XSTest( ISOBMFF_ItemDataReader, WithoutStream )
+{
+    std::vector< uint8_t > data( ItemsFileData() );
+    ISOBMFF::Parser        parser;
+    
+    parser.Parse( data );
+    
+    ISOBMFF::ItemDataReader reader( *( parser.GetFile()->GetTypedBox< ISOBMFF::META >( "meta" ) ), nullptr );
+    
+    XSTestAssertEqual( ItemString( reader, 2 ), "234" );
+    XSTestAssertThrow( reader.GetData( 1 ), std::runtime_error );
+    XSTestAssertThrow( reader.GetData( 3 ), std::runtime_error );
+}
+
+XSTest( ISOBMFF_ItemDataReader, FileWithoutMeta )
+{
+    ISOBMFF::Parser parser( ExampleFile( "MOV1.MOV" ) );
+    
+    XSTestAssertThrow( ISOBMFF::ItemDataReader( *( parser.GetFile() ), nullptr ), std::runtime_error );
+}
@@ -0,0 +1,110 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        MDAT.cpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#include <ISOBMFF.hpp>
+#include <XSTest/XSTest.hpp>
+#include "ExampleFiles.hpp"
+#include <dirent.h>
+
+/* Counts the file descriptors open in the process */
+static size_t OpenFileDescriptors()
+{
+    DIR *   dir;
+    size_t  count;
+    
+    dir   = opendir( "/dev/fd" );
+    count = 0;
+    
+    if( dir == nullptr )
+    {
+        return 0;
+    }
+    
+    while( readdir( dir ) != nullptr )
+    {
+        count++;
+    }
+    
+    closedir( dir );
+    
+    return count;
+}
+
+static std::shared_ptr< ISOBMFF::MDAT > GetMDAT( const ISOBMFF::File & file )
+{
+    return std::dynamic_pointer_cast< ISOBMFF::MDAT >( file.GetBox( "mdat" ) );
+}
+
+XSTest( ISOBMFF_MDAT, DataFromPath )
+{
+    ISOBMFF::Parser parser( ExampleFile( "IMG1.HEIC" ) );
+    
+    auto mdat( GetMDAT( *( parser.GetFile() ) ) );
+    auto data( ExampleFileData( "IMG1.HEIC" ) );
+    
+    XSTestAssertNotEqual( mdat, nullptr );
+    XSTestAssertTrue( mdat->IsDataAvailable() );
+    XSTestAssertEqual( mdat->GetData().size(), mdat->GetDataLength() );
+    XSTestAssertTrue( mdat->GetData( 0, 16 ) == std::vector< uint8_t >( data.begin() + static_cast< std::ptrdiff_t >( mdat->GetDataOffset() ), data.begin() + static_cast< std::ptrdiff_t >( mdat->GetDataOffset() + 16 ) ) );
+}
+
+XSTest( ISOBMFF_MDAT, SkipMDATDataReleasesFiles )
+{
+    std::vector< std::shared_ptr< ISOBMFF::File > > files;
+    size_t                                          count;
+    
+    count = OpenFileDescriptors();
+    
+    for( const auto & option: { ISOBMFF::Parser::Options::SkipMDATData, ISOBMFF::Parser::Options::UseMemoryMappedFiles } )
+    {
+        ISOBMFF::Parser parser;
+        
+        parser.AddOption( ISOBMFF::Parser::Options::SkipMDATData );
+        parser.AddOption( option );
+        
+        for( int i = 0; i < 20; i++ )
+        {
+            parser.Parse( ExampleFile( "IMG1.HEIC" ) );
+            files.push_back( parser.GetFile() );
+        }
+    }
+    
+    XSTestAssertEqual( OpenFileDescriptors(), count );
+    
+    for( const auto & file: files )
+    {
+        auto mdat( GetMDAT( *( file ) ) );
+        
+        XSTestAssertNotEqual( mdat, nullptr );
+        XSTestAssertFalse( mdat->IsDataAvailable() );
+        XSTestAssertGreater( mdat->GetDataLength(), 0U );
+        XSTestAssertThrow( mdat->GetData( 0, 1 ), std::runtime_error );
+    }
+}
@@ -30,6 +30,341 @@
 
 #include <ISOBMFF.hpp>
 #include <XSTest/XSTest.hpp>
+#include "ExampleFiles.hpp"
 
 XSTest( ISOBMFF_Parser, CTOR )
 {}
+
+static void CompareBoxes( const std::shared_ptr< ISOBMFF::Box > & box1, const std::shared_ptr< ISOBMFF::Box > & box2 )
+{
+    XSTestAssertNotEqual( box1, nullptr );
+    XSTestAssertNotEqual( box2, nullptr );
+    
+    XSTestAssertEqual( box1->GetName(), box2->GetName() );
+    XSTestAssertTrue( box1->GetDisplayableProperties() == box2->GetDisplayableProperties() );
+    
+    auto container1( std::dynamic_pointer_cast< ISOBMFF::Container >( box1 ) );
+    auto container2( std::dynamic_pointer_cast< ISOBMFF::Container >( box2 ) );
+    
+    XSTestAssertEqual( container1 == nullptr, container2 == nullptr );
+    
+    if( container1 != nullptr )
+    {
+        auto boxes1( container1->GetBoxes() );
+        auto boxes2( container2->GetBoxes() );
+        
+        XSTestAssertEqual( boxes1.size(), boxes2.size() );
+        
+        for( size_t i = 0; i < boxes1.size(); i++ )
+        {
+            CompareBoxes( boxes1[ i ], boxes2[ i ] );
+        }
+    }
+}
+
+static std::shared_ptr< ISOBMFF::Box > FindChildBox( const ISOBMFF::Container & container, const std::string & name )
+{
+    for( const auto & box: container.GetBoxes() )
+    {
+        if( box->GetName() == name )
+        {
+            return box;
+        }
+    }
+    
+    return nullptr;
+}
+
+XSTest( ISOBMFF_Parser, LazyParsingEqualsEager )
+{
+    for( const auto & name: { "IMG1.HEIC", "IMG2.HEIC", "MOV1.MOV" } )
+    {
+        ISOBMFF::Parser eager;
+        ISOBMFF::Parser lazy;
+        
+        lazy.AddOption( ISOBMFF::Parser::Options::LazyParsing );
+        
+        eager.Parse( ExampleFile( name ) );
+        lazy.Parse( ExampleFile( name ) );
+        
+        CompareBoxes( eager.GetFile(), lazy.GetFile() );
+        
+        XSTestAssertEqual( eager.GetFile()->ToString(), lazy.GetFile()->ToString() );
+    }
+}
+
+XSTest( ISOBMFF_Parser, LazyParsingLoadsOnAccess )
+{
+    ISOBMFF::Parser parser;
+    
+    parser.AddOption( ISOBMFF::Parser::Options::LazyParsing );
+    parser.Parse( ExampleFile( "IMG1.HEIC" ) );
+    
+    auto meta( std::dynamic_pointer_cast< ISOBMFF::META >( FindChildBox( *( parser.GetFile() ), "meta" ) ) );
+    
+    XSTestAssertNotEqual( meta, nullptr );
+    XSTestAssertFalse( meta->IsLoaded() );
+    
+    auto iloc( std::dynamic_pointer_cast< ISOBMFF::ILOC >( FindChildBox( *( meta ), "iloc" ) ) );
+    
+    XSTestAssertNotEqual( iloc, nullptr );
+    XSTestAssertTrue( meta->IsLoaded() );
+    XSTestAssertFalse( iloc->IsLoaded() );
+    XSTestAssertGreater( iloc->GetItems().size(), 0U );
+    XSTestAssertTrue( iloc->IsLoaded() );
+}
+
+XSTest( ISOBMFF_Parser, LazyParsingTruncatedBox )
+{
+    /* The mvhd box only has its version and flags */
+    std::vector< uint8_t > data( { 0, 0, 0, 20, 'm', 'o', 'o', 'v', 0, 0, 0, 12, 'm', 'v', 'h', 'd', 0, 0, 0, 0 } );
+    ISOBMFF::Parser        parser;
+    
+    parser.AddOption( ISOBMFF::Parser::Options::LazyParsing );
+    parser.Parse( data );
+    
+    auto moov( std::dynamic_pointer_cast< ISOBMFF::ContainerBox >( FindChildBox( *( parser.GetFile() ), "moov" ) ) );
+    
+    XSTestAssertNotEqual( moov, nullptr );
+    
+    auto mvhd( std::dynamic_pointer_cast< ISOBMFF::MVHD >( FindChildBox( *( moov ), "mvhd" ) ) );
+    
+    XSTestAssertNotEqual( mvhd, nullptr );
+    XSTestAssertFalse( mvhd->IsLoaded() );
+    XSTestAssertAnyThrow( mvhd->GetCreationTime() );
+    XSTestAssertFalse( mvhd->IsLoaded() );
+    XSTestAssertAnyThrow( mvhd->GetCreationTime() );
+}
+
+XSTest( ISOBMFF_Parser, LazyParsingFromData )
+{
+    std::vector< uint8_t > data( ExampleFileData( "IMG1.HEIC" ) );
+    ISOBMFF::Parser        eager;
+    ISOBMFF::Parser        lazy;
+    
+    lazy.AddOption( ISOBMFF::Parser::Options::LazyParsing );
+    
+    eager.Parse( data );
+    lazy.Parse( data );
+    
+    /* The boxes are loaded once the data stream used while parsing is gone */
+    CompareBoxes( eager.GetFile(), lazy.GetFile() );
+}
+
+XSTest( ISOBMFF_Parser, LazyParsingFromSlice )
+{
+    std::vector< uint8_t > file( ExampleFileData( "IMG1.HEIC" ) );
+    std::vector< uint8_t > data( 100, 0xFF );
+    ISOBMFF::Parser        eager;
+    ISOBMFF::Parser        lazy;
+    
+    data.insert( data.end(), file.begin(), file.end() );
+    
+    auto stream( std::make_shared< ISOBMFF::BinaryDataStream >( data ) );
+    auto slice( std::make_shared< ISOBMFF::BinarySliceStream >( *( stream ), 100, file.size() ) );
+    
+    lazy.AddOption( ISOBMFF::Parser::Options::LazyParsing );
+    
+    eager.Parse( file );
+    lazy.Parse( slice );
+    
+    CompareBoxes( eager.GetFile(), lazy.GetFile() );
+}
+
+XSTest( ISOBMFF_Parser, PathFilters )
+{
+    ISOBMFF::Parser parser;
+    ISOBMFF::Parser eager;
+    
+    parser.AddPathFilter( "moov/trak/tkhd" );
+    parser.Parse( ExampleFile( "MOV1.MOV" ) );
+    eager.Parse( ExampleFile( "MOV1.MOV" ) );
+    
+    auto file( parser.GetFile() );
+    
+    XSTestAssertEqual( file->GetBoxes().size(), 2U );
+    XSTestAssertNotEqual( file->GetTypedBox< ISOBMFF::FTYP >( "ftyp" ), nullptr );
+    XSTestAssertEqual( file->Container::GetBoxes( "mdat" ).size(), 0U );
+    
+    auto moov( file->GetTypedBox< ISOBMFF::ContainerBox >( "moov" ) );
+    auto traks( eager.GetFile()->GetTypedBox< ISOBMFF::ContainerBox >( "moov" )->Container::GetBoxes( "trak" ) );
+    
+    XSTestAssertNotEqual( moov, nullptr );
+    XSTestAssertEqual( moov->GetBoxes().size(), traks.size() );
+    XSTestAssertGreater( traks.size(), 0U );
+    
+    for( size_t i = 0; i < traks.size(); i++ )
+    {
+        auto trak( std::dynamic_pointer_cast< ISOBMFF::ContainerBox >( moov->GetBoxes()[ i ] ) );
+        
+        XSTestAssertNotEqual( trak, nullptr );
+        XSTestAssertEqual( trak->GetName(), "trak" );
+        XSTestAssertEqual( trak->GetBoxes().size(), 1U );
+        
+        auto tkhd1( trak->GetTypedBox< ISOBMFF::TKHD >( "tkhd" ) );
+        auto tkhd2( std::dynamic_pointer_cast< ISOBMFF::ContainerBox >( traks[ i ] )->GetTypedBox< ISOBMFF::TKHD >( "tkhd" ) );
+        
+        XSTestAssertNotEqual( tkhd1, nullptr );
+        XSTestAssertEqual( tkhd1->GetTrackID(), tkhd2->GetTrackID() );
+        XSTestAssertEqual( tkhd1->GetWidth(),   tkhd2->GetWidth() );
+        XSTestAssertEqual( tkhd1->GetHeight(),  tkhd2->GetHeight() );
+    }
+}
+
+XSTest( ISOBMFF_Parser, PathFiltersKeepPropertyIndices )
+{
+    ISOBMFF::Parser parser;
+    ISOBMFF::Parser eager;
+    
+    parser.AddPathFilter( "meta/pitm" );
+    parser.AddPathFilter( "meta/iprp/ipma" );
+    parser.AddPathFilter( "meta/iprp/ipco/ispe" );
+    parser.Parse( ExampleFile( "IMG1.HEIC" ) );
+    eager.Parse( ExampleFile( "IMG1.HEIC" ) );
+    
+    auto ipco1( parser.GetFile()->GetTypedBox< ISOBMFF::META >( "meta" )->GetTypedBox< ISOBMFF::ContainerBox >( "iprp" )->GetTypedBox< ISOBMFF::IPCO >( "ipco" ) );
+    auto ipco2( eager.GetFile()->GetTypedBox< ISOBMFF::META >( "meta" )->GetTypedBox< ISOBMFF::ContainerBox >( "iprp" )->GetTypedBox< ISOBMFF::IPCO >( "ipco" ) );
+    
+    XSTestAssertNotEqual( ipco1, nullptr );
+    XSTestAssertEqual( ipco1->GetBoxes().size(), ipco2->GetBoxes().size() );
+    
+    for( size_t i = 0; i < ipco2->GetBoxes().size(); i++ )
+    {
+        auto box1( ipco1->GetPropertyAtIndex( i ) );
+        auto box2( ipco2->GetPropertyAtIndex( i ) );
+        
+        XSTestAssertEqual( box1->GetType(), box2->GetType() );
+        
+        if( box2->GetType() == ISOBMFF::FourCC( "ispe" ) )
+        {
+            XSTestAssertEqual( std::dynamic_pointer_cast< ISOBMFF::ISPE >( box1 )->GetDisplayWidth(), std::dynamic_pointer_cast< ISOBMFF::ISPE >( box2 )->GetDisplayWidth() );
+        }
+        else
+        {
+            XSTestAssertEqual( box1->GetData().size(), 0U );
+        }
+    }
+    
+    ISOBMFF::ItemIndex index1( *( parser.GetFile() ) );
+    ISOBMFF::ItemIndex index2( *( eager.GetFile() ) );
+    uint32_t           primary( index2.GetPrimaryItemID() );
+    
+    XSTestAssertEqual( index1.GetPrimaryItemID(), primary );
+    XSTestAssertNotEqual( index1.GetTypedProperty< ISOBMFF::ISPE >( primary, ISOBMFF::FourCC( "ispe" ) ), nullptr );
+    XSTestAssertEqual
+    (
+        index1.GetTypedProperty< ISOBMFF::ISPE >( primary, ISOBMFF::FourCC( "ispe" ) )->GetDisplayHeight(),
+        index2.GetTypedProperty< ISOBMFF::ISPE >( primary, ISOBMFF::FourCC( "ispe" ) )->GetDisplayHeight()
+    );
+    XSTestAssertEqual( index1.GetTypedProperty< ISOBMFF::HVCC >( primary, ISOBMFF::FourCC( "hvcC" ) ), nullptr );
+}
+
+static std::vector< std::string > ParseManyPaths()
+{
+    std::vector< std::string > paths;
+    size_t                     i;
+    
+    for( i = 0; i < 16; i++ )
+    {
+        paths.push_back( ExampleFile( "IMG1.HEIC" ) );
+        paths.push_back( ExampleFile( "MOV1.MOV" ) );
+        paths.push_back( ExampleFile( "MISSING.HEIC" ) );
+    }
+    
+    return paths;
+}
+
+XSTest( ISOBMFF_Parser, ParseManyInputOrder )
+{
+    std::vector< std::string > paths( ParseManyPaths() );
+    std::vector< size_t >      indices;
+    ISOBMFF::Parser            parser;
+    
+    parser.AddOption( ISOBMFF::Parser::Options::SkipMDATData );
+    
+    ISOBMFF::Parser::ParseMany
+    (
+        paths,
+        parser,
+        4,
+        [ & ]( size_t index, const std::shared_ptr< ISOBMFF::File > & file, const std::string & error )
+        {
+            indices.push_back( index );
+            
+            if( index % 3 == 2 )
+            {
+                XSTestAssertEqual( file, nullptr );
+                XSTestAssertFalse( error.empty() );
+            }
+            else
+            {
+                XSTestAssertNotEqual( file, nullptr );
+                XSTestAssertTrue( error.empty() );
+                XSTestAssertGreater( file->GetBoxes().size(), 0U );
+            }
+        },
+        true
+    );
+    
+    XSTestAssertEqual( indices.size(), paths.size() );
+    
+    for( size_t i = 0; i < indices.size(); i++ )
+    {
+        XSTestAssertEqual( indices[ i ], i );
+    }
+}
+
+XSTest( ISOBMFF_Parser, ParseManyAnyOrder )
+{
+    std::vector< std::string > paths( ParseManyPaths() );
+    std::vector< bool >        received( paths.size(), false );
+    
+    ISOBMFF::Parser::ParseMany
+    (
+        paths,
+        ISOBMFF::Parser(),
+        0,
+        [ & ]( size_t index, const std::shared_ptr< ISOBMFF::File > & file, const std::string & error )
+        {
+            XSTestAssertFalse( received[ index ] );
+            XSTestAssertEqual( file == nullptr, index % 3 == 2 );
+            XSTestAssertEqual( error.empty(), index % 3 != 2 );
+            
+            received[ index ] = true;
+        }
+    );
+    
+    for( bool r: received )
+    {
+        XSTestAssertTrue( r );
+    }
+}
+
+XSTest( ISOBMFF_Parser, ParseManyCallbackThrows )
+{
+    for( bool inputOrder: { false, true } )
+    {
+        size_t count( 0 );
+        
+        XSTestAssertThrow
+        (
+            ISOBMFF::Parser::ParseMany
+            (
+                ParseManyPaths(),
+                ISOBMFF::Parser(),
+                4,
+                [ & ]( size_t, const std::shared_ptr< ISOBMFF::File > &, const std::string & )
+                {
+                    if( ++count == 3 )
+                    {
+                        throw std::runtime_error( "Stop" );
+                    }
+                },
+                inputOrder
+            ),
+            std::runtime_error
+        );
+        
+        XSTestAssertEqual( count, 3U );
+    }
+}
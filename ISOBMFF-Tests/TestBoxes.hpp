@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        TestBoxes.hpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#ifndef ISOBMFF_TESTS_TEST_BOXES_HPP
+#define ISOBMFF_TESTS_TEST_BOXES_HPP
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+/*!
+ * @function    AppendUInt16
+ * @abstract    Appends a big-endian 16-bits value.
+ * @param       data    The data to append to.
+ * @param       value   The value to append.
+ */
+inline void AppendUInt16( std::vector< uint8_t > & data, uint16_t value )
+{
+    data.push_back( static_cast< uint8_t >( value >> 8 ) );
+    data.push_back( static_cast< uint8_t >( value ) );
+}
+
+/*!
+ * @function    AppendUInt32
+ * @abstract    Appends a big-endian 32-bits value.
+ * @param       data    The data to append to.
+ * @param       value   The value to append.
+ */
+inline void AppendUInt32( std::vector< uint8_t > & data, uint32_t value )
+{
+    AppendUInt16( data, static_cast< uint16_t >( value >> 16 ) );
+    AppendUInt16( data, static_cast< uint16_t >( value ) );
+}
+
+/*!
+ * @function    AppendUInt64
+ * @abstract    Appends a big-endian 64-bits value.
+ * @param       data    The data to append to.
+ * @param       value   The value to append.
+ */
+inline void AppendUInt64( std::vector< uint8_t > & data, uint64_t value )
+{
+    AppendUInt32( data, static_cast< uint32_t >( value >> 32 ) );
+    AppendUInt32( data, static_cast< uint32_t >( value ) );
+}
+
+/*!
+ * @function    AppendData
+ * @abstract    Appends bytes, like the data of another box.
+ * @param       data    The data to append to.
+ * @param       bytes   The bytes to append.
+ */
+inline void AppendData( std::vector< uint8_t > & data, const std::vector< uint8_t > & bytes )
+{
+    data.insert( data.end(), bytes.begin(), bytes.end() );
+}
+
+/*!
+ * @function    MakeBox
+ * @abstract    Creates a box with a declared size.
+ * @param       type    The box type.
+ * @param       size    The size written in the box header, which may not
+ *                      match the content, like 0 for the last box.
+ * @param       content The box content.
+ * @result      The box data.
+ */
+inline std::vector< uint8_t > MakeBox( const std::string & type, uint32_t size, const std::vector< uint8_t > & content )
+{
+    std::vector< uint8_t > data;
+    
+    AppendUInt32( data, size );
+    data.insert( data.end(), type.begin(), type.end() );
+    AppendData( data, content );
+    
+    return data;
+}
+
+/*!
+ * @function    MakeBox
+ * @abstract    Creates a box.
+ * @param       type    The box type.
+ * @param       content The box content.
+ * @result      The box data.
+ */
+inline std::vector< uint8_t > MakeBox( const std::string & type, const std::vector< uint8_t > & content )
+{
+    return MakeBox( type, static_cast< uint32_t >( content.size() + 8 ), content );
+}
+
+/*!
+ * @function    MakeLargeBox
+ * @abstract    Creates a box with a 64-bits size.
+ * @param       type    The box type.
+ * @param       content The box content.
+ * @result      The box data.
+ */
+inline std::vector< uint8_t > MakeLargeBox( const std::string & type, const std::vector< uint8_t > & content )
+{
+    std::vector< uint8_t > data( MakeBox( type, 1, {} ) );
+    
+    AppendUInt64( data, content.size() + 16 );
+    AppendData( data, content );
+    
+    return data;
+}
+
+/*!
+ * @function    MakeFTYPBox
+ * @abstract    Creates a 20 bytes ftyp box, for HEIF files.
+ * @result      The box data.
+ */
+inline std::vector< uint8_t > MakeFTYPBox()
+{
+    return MakeBox( "ftyp", { 'h', 'e', 'i', 'c', 0, 0, 0, 0, 'm', 'i', 'f', '1' } );
+}
+
+#endif /* ISOBMFF_TESTS_TEST_BOXES_HPP */
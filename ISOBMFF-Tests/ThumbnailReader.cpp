@@ -0,0 +1,166 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ThumbnailReader.cpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#include <ISOBMFF.hpp>
+#include <XSTest/XSTest.hpp>
+#include "ExampleFiles.hpp"
+#include "CountingFetch.hpp"
+#include "TestBoxes.hpp"
+
+/* Fetch stream counting the positional reads made on it */
+class CountingStream: public ISOBMFF::BinaryFetchStream
+{
+    public:
+        
+        CountingStream( const CountingFetch & fetch ):
+            ISOBMFF::BinaryFetchStream( fetch.Size(), fetch, 1024, 8 ),
+            _reads( 0 )
+        {}
+        
+        void ReadAt( uint64_t offset, uint8_t * buf, size_t size ) const override
+        {
+            this->_reads++;
+            
+            ISOBMFF::BinaryFetchStream::ReadAt( offset, buf, size );
+        }
+        
+        mutable size_t _reads;
+};
+
+/* Finds the thumbnail of the primary item and its data, from a fully parsed file */
+static uint32_t ExpectedThumbnail( const std::string & name, std::vector< uint8_t > & data )
+{
+    ISOBMFF::Parser        parser( ExampleFile( name ) );
+    std::vector< uint8_t > file( ExampleFileData( name ) );
+    uint32_t               thumbnail( 0 );
+    
+    auto meta( parser.GetFile()->GetTypedBox< ISOBMFF::META >( "meta" ) );
+    auto pitm( meta->GetTypedBox< ISOBMFF::PITM >( "pitm" ) );
+    auto iref( meta->GetTypedBox< ISOBMFF::IREF >( "iref" ) );
+    auto iloc( meta->GetTypedBox< ISOBMFF::ILOC >( "iloc" ) );
+    
+    for( const auto & box: iref->GetBoxes() )
+    {
+        auto reference( std::dynamic_pointer_cast< ISOBMFF::SingleItemTypeReferenceBox >( box ) );
+        
+        if( thumbnail == 0 && reference != nullptr && reference->GetName() == "thmb" )
+        {
+            for( uint32_t id: reference->GetToItemIDs() )
+            {
+                if( id == pitm->GetItemID() )
+                {
+                    thumbnail = reference->GetFromItemID();
+                }
+            }
+        }
+    }
+    
+    data.clear();
+    
+    for( const auto & item: iloc->GetItems() )
+    {
+        if( item->GetItemID() != thumbnail )
+        {
+            continue;
+        }
+        
+        for( const auto & extent: item->GetExtents() )
+        {
+            auto begin( file.begin() + static_cast< std::ptrdiff_t >( item->GetBaseOffset() + extent->GetOffset() ) );
+            
+            data.insert( data.end(), begin, begin + static_cast< std::ptrdiff_t >( extent->GetLength() ) );
+        }
+    }
+    
+    return thumbnail;
+}
+
+XSTest( ISOBMFF_ThumbnailReader, ExampleFiles )
+{
+    for( const auto & name: { "IMG1.HEIC", "IMG2.HEIC" } )
+    {
+        CountingFetch                    fetch( ExampleFile( name ) );
+        std::shared_ptr< CountingStream > stream( std::make_shared< CountingStream >( fetch ) );
+        std::vector< uint8_t >            expected;
+        uint32_t                          id( ExpectedThumbnail( name, expected ) );
+        
+        ISOBMFF::ThumbnailReader reader( stream );
+        
+        XSTestAssertNotEqual( id, 0U );
+        XSTestAssertTrue( reader.HasThumbnail() );
+        XSTestAssertEqual( reader.GetItemID(), id );
+        XSTestAssertEqual( reader.GetItemType(), "hvc1" );
+        XSTestAssertGreater( reader.GetWidth(), 0U );
+        XSTestAssertGreater( reader.GetHeight(), 0U );
+        XSTestAssertNotEqual( reader.GetHVCC(), nullptr );
+        
+        /* Two box headers, then ftyp and meta at once */
+        XSTestAssertEqual( stream->_reads, 3U );
+        XSTestAssertLessOrEqual( fetch.Count(), 3U );
+        
+        auto data( reader.GetData() );
+        
+        XSTestAssertGreater( data.size(), 0U );
+        XSTestAssertTrue( data == expected );
+        
+        /* And the thumbnail data */
+        XSTestAssertEqual( stream->_reads, 4U );
+        XSTestAssertLessOrEqual( fetch.Count(), 4U );
+        XSTestAssertLess( fetch.Bytes(), fetch.Size() / 2 );
+    }
+}
+
+XSTest( ISOBMFF_ThumbnailReader, Bitstream )
+{
+    ISOBMFF::ThumbnailReader reader( ExampleFile( "IMG1.HEIC" ) );
+    std::vector< uint8_t >   bitstream( reader.GetBitstream() );
+    std::vector< uint8_t >   data( reader.GetData() );
+    
+    /* Annex B start codes replace the 4 bytes NAL unit lengths */
+    XSTestAssertGreater( bitstream.size(), data.size() );
+    XSTestAssertEqual( bitstream[ 0 ], 0 );
+    XSTestAssertEqual( bitstream[ 1 ], 0 );
+    XSTestAssertEqual( bitstream[ 2 ], 0 );
+    XSTestAssertEqual( bitstream[ 3 ], 1 );
+    XSTestAssertTrue( std::equal( data.begin() + 4, data.end(), bitstream.end() - static_cast< std::ptrdiff_t >( data.size() - 4 ) ) );
+}
+
+XSTest( ISOBMFF_ThumbnailReader, InvalidFiles )
+{
+    std::vector< uint8_t > noMeta( MakeFTYPBox() );
+    std::vector< uint8_t > truncated( MakeFTYPBox() );
+    
+    AppendData( noMeta, MakeBox( "mdat", std::vector< uint8_t >( 10, 0 ) ) );
+    AppendData( truncated, MakeBox( "meta", 100, { 0, 0, 0, 0 } ) );
+    
+    XSTestAssertThrow( ISOBMFF::ThumbnailReader( std::make_shared< ISOBMFF::BinaryDataStream >( noMeta ) ),    std::runtime_error );
+    XSTestAssertThrow( ISOBMFF::ThumbnailReader( std::make_shared< ISOBMFF::BinaryDataStream >( truncated ) ), std::runtime_error );
+    XSTestAssertFalse( ISOBMFF::ThumbnailReader().HasThumbnail() );
+}
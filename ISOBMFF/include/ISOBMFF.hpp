@@ -33,13 +33,27 @@
 
 #include <ISOBMFF/Macros.hpp>
 #include <ISOBMFF/Utils.hpp>
+#include <ISOBMFF/FourCC.hpp>
+#include <ISOBMFF/DataView.hpp>
+#include <ISOBMFF/Arena.hpp>
 #include <ISOBMFF/Parser.hpp>
 #include <ISOBMFF/BinaryStream.hpp>
+#include <ISOBMFF/BinaryDataReader.hpp>
 #include <ISOBMFF/BinaryDataStream.hpp>
 #include <ISOBMFF/BinaryFileStream.hpp>
+#include <ISOBMFF/BinaryFetchStream.hpp>
+#include <ISOBMFF/BinaryMappedFileStream.hpp>
+#include <ISOBMFF/BinarySliceStream.hpp>
 #include <ISOBMFF/DisplayableObject.hpp>
 #include <ISOBMFF/DisplayableObjectContainer.hpp>
 #include <ISOBMFF/Box.hpp>
+#include <ISOBMFF/BoxLayout.hpp>
+#include <ISOBMFF/BoxVisitor.hpp>
+#include <ISOBMFF/FlatFile.hpp>
+#include <ISOBMFF/IncrementalParser.hpp>
+#include <ISOBMFF/ItemDataReader.hpp>
+#include <ISOBMFF/ItemIndex.hpp>
+#include <ISOBMFF/ThumbnailReader.hpp>
 #include <ISOBMFF/FullBox.hpp>
 #include <ISOBMFF/Container.hpp>
 #include <ISOBMFF/ContainerBox.hpp>
@@ -73,6 +87,7 @@
 #include <ISOBMFF/STSD.hpp>
 #include <ISOBMFF/FRMA.hpp>
 #include <ISOBMFF/SCHM.hpp>
+#include <ISOBMFF/MDAT.hpp>
 
 #ifdef _WIN32
 #include <ISOBMFF/WIN32.hpp>
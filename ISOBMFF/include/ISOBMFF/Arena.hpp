@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @header      Arena.hpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#ifndef ISOBMFF_ARENA_HPP
+#define ISOBMFF_ARENA_HPP
+
+#include <memory>
+#include <algorithm>
+#include <ISOBMFF/Macros.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace ISOBMFF
+{
+    /*!
+     * @class       Arena
+     * @abstract    Monotonic memory arena.
+     * @discussion  Memory is carved out of large chunks, and is only
+     *              released when the arena is destroyed.
+     *              An arena may not be used from several threads at once.
+     * @see         ArenaAllocator
+     */
+    class ISOBMFF_EXPORT Arena
+    {
+        public:
+            
+            /*!
+             * @var         DefaultChunkSize
+             * @abstract    Default size of the arena chunks, in bytes.
+             */
+            static const size_t DefaultChunkSize = 64 * 1024;
+            
+            /*!
+             * @function    Arena
+             * @abstract    Creates an arena.
+             * @param       chunkSize   The size of the arena chunks, in bytes.
+             */
+            Arena( size_t chunkSize = DefaultChunkSize );
+            
+            virtual ~Arena();
+            
+            Arena( const Arena & o )              = delete;
+            Arena & operator =( const Arena & o ) = delete;
+            
+            /*!
+             * @function    Allocate
+             * @abstract    Allocates memory from the arena.
+             * @param       size        The number of bytes to allocate.
+             * @param       alignment   The required alignment (a power of two).
+             * @result      The allocated memory, valid until the arena is destroyed.
+             */
+            void * Allocate( size_t size, size_t alignment );
+            
+            /*!
+             * @function    GetAllocatedBytes
+             * @abstract    Gets the number of bytes allocated from the arena.
+             * @result      The allocated bytes, excluding alignment padding.
+             */
+            uint64_t GetAllocatedBytes() const;
+            
+            /*!
+             * @function    GetChunkCount
+             * @abstract    Gets the number of chunks reserved by the arena.
+             * @result      The number of chunks.
+             */
+            size_t GetChunkCount() const;
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+    
+    /*!
+     * @class       ArenaAllocator
+     * @abstract    Standard allocator using an arena.
+     * @discussion  Deallocation does nothing. The allocator retains the
+     *              arena, so objects created with std::allocate_shared
+     *              keep it alive.
+     */
+    template< class _T_ >
+    class ArenaAllocator
+    {
+        public:
+            
+            using value_type = _T_;
+            
+            ArenaAllocator( std::shared_ptr< Arena > arena ) noexcept:
+                _arena( std::move( arena ) )
+            {}
+            
+            template< class _U_ >
+            ArenaAllocator( const ArenaAllocator< _U_ > & o ) noexcept:
+                _arena( o._arena )
+            {}
+            
+            _T_ * allocate( size_t n )
+            {
+                return static_cast< _T_ * >( this->_arena->Allocate( n * sizeof( _T_ ), alignof( _T_ ) ) );
+            }
+            
+            void deallocate( _T_ * p, size_t n ) noexcept
+            {
+                ( void )p;
+                ( void )n;
+            }
+            
+            template< class _U_ >
+            bool operator ==( const ArenaAllocator< _U_ > & o ) const noexcept
+            {
+                return this->_arena == o._arena;
+            }
+            
+            template< class _U_ >
+            bool operator !=( const ArenaAllocator< _U_ > & o ) const noexcept
+            {
+                return this->_arena != o._arena;
+            }
+            
+        private:
+            
+            template< class _U_ >
+            friend class ArenaAllocator;
+            
+            std::shared_ptr< Arena > _arena;
+    };
+}
+
+#endif /* ISOBMFF_ARENA_HPP */
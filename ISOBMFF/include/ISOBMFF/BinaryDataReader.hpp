@@ -0,0 +1,368 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      BinaryDataReader.hpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#ifndef ISOBMFF_BINARY_DATA_READER_HPP
+#define ISOBMFF_BINARY_DATA_READER_HPP
+
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <vector>
+#include <stdexcept>
+#include <ISOBMFF/BinaryStream.hpp>
+#include <ISOBMFF/Matrix.hpp>
+
+namespace ISOBMFF
+{
+    /*!
+     * @class       BinaryDataReader
+     * @abstract    Non-virtual cursor on a contiguous range of memory.
+     * @discussion  Provides the same read methods as BinaryStream, all
+     *              inlined, so box parsers can be written once for both.
+     *              The reader doesn't own the data, and is meant to live
+     *              only for the duration of a box parse.
+     */
+    class BinaryDataReader
+    {
+        public:
+            
+            using SeekDirection = BinaryStream::SeekDirection;
+            
+            BinaryDataReader( const uint8_t * data, size_t size ):
+                _data( data ),
+                _size( size ),
+                _pos( 0 )
+            {}
+            
+            /*!
+             * @function    Dispatch
+             * @abstract    Calls a parse function with the fastest reader for a stream.
+             * @param       stream  The stream to read from.
+             * @param       func    A function or generic lambda, taking either a
+             *                      BinaryDataReader or a BinaryStream.
+             * @discussion  If the remaining stream data can be exposed as
+             *              contiguous memory, func gets a reader on it, and
+             *              the stream is then advanced by the number of bytes
+             *              read. Otherwise func simply gets the stream.
+             *              The stream must not be used directly from func.
+             */
+            template< typename F >
+            static void Dispatch( BinaryStream & stream, F func )
+            {
+                size_t          size;
+                const uint8_t * data;
+                
+                size = stream.AvailableBytes();
+                data = stream.GetContiguousBytes( size );
+                
+                if( data == nullptr )
+                {
+                    func( stream );
+                }
+                else
+                {
+                    BinaryDataReader reader( data, size );
+                    
+                    func( reader );
+                    
+                    stream.Seek( reader.Tell() );
+                }
+            }
+            
+            size_t Tell() const
+            {
+                return this->_pos;
+            }
+            
+            size_t Size() const
+            {
+                return this->_size;
+            }
+            
+            size_t AvailableBytes() const
+            {
+                return this->_size - this->_pos;
+            }
+            
+            bool HasBytesAvailable() const
+            {
+                return this->_pos < this->_size;
+            }
+            
+            void Seek( std::streamoff offset )
+            {
+                this->Seek( offset, SeekDirection::Current );
+            }
+            
+            template< typename T, typename std::enable_if< std::is_integral< T >::value && std::is_unsigned< T >::value >::type * = nullptr >
+            void Seek( T offset )
+            {
+                this->Seek( numeric_cast< std::streamoff >( offset ) );
+            }
+            
+            void Seek( std::streamoff offset, SeekDirection dir )
+            {
+                std::streamoff base;
+                
+                if( dir == SeekDirection::Begin )
+                {
+                    base = 0;
+                }
+                else if( dir == SeekDirection::End )
+                {
+                    base = static_cast< std::streamoff >( this->_size );
+                }
+                else
+                {
+                    base = static_cast< std::streamoff >( this->_pos );
+                }
+                
+                if( ( offset < 0 && -offset > base ) || ( offset > 0 && static_cast< size_t >( offset ) > this->_size - static_cast< size_t >( base ) ) )
+                {
+                    throw std::runtime_error( "Invalid seek offset" );
+                }
+                
+                this->_pos = static_cast< size_t >( base + offset );
+            }
+            
+            void Read( uint8_t * buf, size_t size )
+            {
+                this->Require( size );
+                
+                if( size > 0 )
+                {
+                    memcpy( buf, this->_data + this->_pos, size );
+                }
+                
+                this->_pos += size;
+            }
+            
+            std::vector< uint8_t > Read( size_t size )
+            {
+                this->Require( size );
+                
+                std::vector< uint8_t > data( this->_data + this->_pos, this->_data + this->_pos + size );
+                
+                this->_pos += size;
+                
+                return data;
+            }
+            
+            std::vector< uint8_t > ReadAllData()
+            {
+                return this->Read( this->AvailableBytes() );
+            }
+            
+            uint8_t ReadUInt8()
+            {
+                this->Require( 1 );
+                
+                return this->_data[ this->_pos++ ];
+            }
+            
+            int8_t ReadInt8()
+            {
+                return static_cast< int8_t >( this->ReadUInt8() );
+            }
+            
+            uint16_t ReadBigEndianUInt16()
+            {
+                const uint8_t * p;
+                
+                this->Require( 2 );
+                
+                p           = this->_data + this->_pos;
+                this->_pos += 2;
+                
+                return static_cast< uint16_t >( ( p[ 0 ] << 8 ) | p[ 1 ] );
+            }
+            
+            uint32_t ReadBigEndianUInt32()
+            {
+                const uint8_t * p;
+                
+                this->Require( 4 );
+                
+                p           = this->_data + this->_pos;
+                this->_pos += 4;
+                
+                return ( static_cast< uint32_t >( p[ 0 ] ) << 24 )
+                     | ( static_cast< uint32_t >( p[ 1 ] ) << 16 )
+                     | ( static_cast< uint32_t >( p[ 2 ] ) << 8 )
+                     |   static_cast< uint32_t >( p[ 3 ] );
+            }
+            
+            uint64_t ReadBigEndianUInt64()
+            {
+                uint64_t n;
+                
+                n  = static_cast< uint64_t >( this->ReadBigEndianUInt32() ) << 32;
+                n |= this->ReadBigEndianUInt32();
+                
+                return n;
+            }
+            
+            void ReadBigEndianUInt16Array( uint16_t * out, size_t n )
+            {
+                this->Require( n, sizeof( uint16_t ) );
+                
+                for( size_t i = 0; i < n; i++ )
+                {
+                    out[ i ] = this->ReadBigEndianUInt16();
+                }
+            }
+            
+            void ReadBigEndianUInt32Array( uint32_t * out, size_t n )
+            {
+                this->Require( n, sizeof( uint32_t ) );
+                
+                for( size_t i = 0; i < n; i++ )
+                {
+                    out[ i ] = this->ReadBigEndianUInt32();
+                }
+            }
+            
+            void ReadBigEndianUInt64Array( uint64_t * out, size_t n )
+            {
+                this->Require( n, sizeof( uint64_t ) );
+                
+                for( size_t i = 0; i < n; i++ )
+                {
+                    out[ i ] = this->ReadBigEndianUInt64();
+                }
+            }
+            
+            float ReadBigEndianFixedPoint( unsigned int integerLength, unsigned int fractionalLength )
+            {
+                uint32_t n;
+                
+                if( integerLength + fractionalLength == 16 )
+                {
+                    n = this->ReadBigEndianUInt16();
+                }
+                else
+                {
+                    n = this->ReadBigEndianUInt32();
+                }
+                
+                return static_cast< float >( n >> fractionalLength )
+                     + static_cast< float >( n & ( ( 1u << fractionalLength ) - 1 ) ) / static_cast< float >( 1u << fractionalLength );
+            }
+            
+            std::string ReadFourCC()
+            {
+                this->Require( 4 );
+                
+                this->_pos += 4;
+                
+                return std::string( reinterpret_cast< const char * >( this->_data + this->_pos - 4 ), 4 );
+            }
+            
+            std::string ReadPascalString()
+            {
+                size_t length;
+                
+                length = this->ReadUInt8();
+                
+                this->Require( length );
+                
+                this->_pos += length;
+                
+                return std::string( reinterpret_cast< const char * >( this->_data + this->_pos - length ), length );
+            }
+            
+            std::string ReadString( size_t length )
+            {
+                const void * end;
+                const char * s;
+                
+                this->Require( length );
+                
+                s           = reinterpret_cast< const char * >( this->_data + this->_pos );
+                end         = memchr( s, 0, length );
+                this->_pos += length;
+                
+                return std::string( s, ( end == nullptr ) ? length : static_cast< size_t >( static_cast< const char * >( end ) - s ) );
+            }
+            
+            std::string ReadNULLTerminatedString()
+            {
+                const void * end;
+                const char * s;
+                size_t       length;
+                
+                s   = reinterpret_cast< const char * >( this->_data + this->_pos );
+                end = memchr( s, 0, this->AvailableBytes() );
+                
+                if( end == nullptr )
+                {
+                    throw std::runtime_error( "Invalid read - Not enough data available" );
+                }
+                
+                length      = static_cast< size_t >( static_cast< const char * >( end ) - s );
+                this->_pos += length + 1;
+                
+                return std::string( s, length );
+            }
+            
+            Matrix ReadMatrix()
+            {
+                uint32_t m[ 9 ];
+                
+                this->ReadBigEndianUInt32Array( m, 9 );
+                
+                return Matrix( m[ 0 ], m[ 1 ], m[ 2 ], m[ 3 ], m[ 4 ], m[ 5 ], m[ 6 ], m[ 7 ], m[ 8 ] );
+            }
+            
+        private:
+            
+            void Require( size_t size ) const
+            {
+                if( size > this->_size - this->_pos )
+                {
+                    throw std::runtime_error( "Invalid read - Not enough data available" );
+                }
+            }
+            
+            void Require( size_t n, size_t size ) const
+            {
+                if( n > this->AvailableBytes() / size )
+                {
+                    throw std::runtime_error( "Invalid read - Not enough data available" );
+                }
+            }
+            
+            const uint8_t * _data;
+            size_t          _size;
+            size_t          _pos;
+    };
+}
+
+#endif /* ISOBMFF_BINARY_DATA_READER_HPP */
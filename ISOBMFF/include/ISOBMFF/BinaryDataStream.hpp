@@ -46,6 +46,19 @@ namespace ISOBMFF
             
             BinaryDataStream();
             BinaryDataStream( const std::vector< uint8_t > & data );
+            
+            /*!
+             * @function    BinaryDataStream
+             * @abstract    Creates a stream reading from caller-owned memory.
+             * @param       data    The data bytes.
+             * @param       size    The number of data bytes.
+             * @discussion  The data is not copied, so it must remain valid,
+             *              and unchanged, for the whole lifetime of the stream
+             *              and of any copy of it.
+             *              Views read from such a stream are copies, while
+             *              views read from a stream owning its data share it.
+             */
+            BinaryDataStream( const uint8_t * data, size_t size );
             BinaryDataStream( const BinaryDataStream & o );
             BinaryDataStream( BinaryDataStream && o ) noexcept;
             
@@ -58,6 +71,14 @@ namespace ISOBMFF
             void   Read( uint8_t * buf, size_t size )               override;
             void   Seek( std::streamoff offset, SeekDirection dir ) override;
             size_t Tell()                                     const override;
+            size_t Size()                                     const override;
+            
+            void     ReadAt( uint64_t offset, uint8_t * buf, size_t size ) const override;
+            DataView ReadViewAt( uint64_t offset, size_t size )            const override;
+            
+            void            Get( uint8_t * buf, uint64_t pos, size_t length ) override;
+            const uint8_t * GetContiguousBytes( size_t size )                 override;
+            DataView        ReadView( size_t size )                           override;
             
             ISOBMFF_EXPORT friend void swap( BinaryDataStream & o1, BinaryDataStream & o2 );
             
@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      BinaryFetchStream.hpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#ifndef ISOBMFF_BINARY_FETCH_STREAM_HPP
+#define ISOBMFF_BINARY_FETCH_STREAM_HPP
+
+#include <ISOBMFF/BinaryStream.hpp>
+#include <string>
+#include <iostream>
+#include <cstdint>
+#include <memory>
+#include <algorithm>
+#include <functional>
+
+namespace ISOBMFF
+{
+    /*!
+     * @class       BinaryFetchStream
+     * @abstract    Binary stream reading through a user-supplied fetch function.
+     * @discussion  Meant for data that isn't stored locally, like files in
+     *              an object storage, fetched with range requests.
+     *              Data is fetched in fixed-size blocks, kept in an LRU
+     *              cache. Adjacent missing blocks are fetched with a single
+     *              call, and the next block is fetched along on sequential
+     *              reads. Reads spanning more blocks than the cache can
+     *              hold bypass it.
+     *              The stream may be used from several threads, but calls
+     *              to the fetch function are serialized.
+     */
+    class ISOBMFF_EXPORT BinaryFetchStream: public BinaryStream
+    {
+        public:
+            
+            /*!
+             * @typedef     FetchFunction
+             * @abstract    Fetches a range of data.
+             * @discussion  Must fill buf with exactly size bytes, read from
+             *              offset, or throw an exception.
+             */
+            using FetchFunction = std::function< void( uint64_t offset, uint8_t * buf, size_t size ) >;
+            
+            /*!
+             * @var         DefaultBlockSize
+             * @abstract    Default size of the cached blocks, in bytes.
+             */
+            static const size_t DefaultBlockSize = 64 * 1024;
+            
+            /*!
+             * @var         DefaultBlockCount
+             * @abstract    Default number of cached blocks.
+             */
+            static const size_t DefaultBlockCount = 64;
+            
+            /*!
+             * @function    BinaryFetchStream
+             * @abstract    Creates a stream reading through a fetch function.
+             * @param       size        The total size of the data.
+             * @param       fetch       The function used to fetch data.
+             * @param       blockSize   The size of the cached blocks, in bytes.
+             * @param       blockCount  The number of cached blocks (at least 2).
+             */
+            BinaryFetchStream( uint64_t size, FetchFunction fetch, size_t blockSize = DefaultBlockSize, size_t blockCount = DefaultBlockCount );
+            
+            virtual ~BinaryFetchStream() override;
+            
+            BinaryFetchStream( const BinaryFetchStream & o )              = delete;
+            BinaryFetchStream( BinaryFetchStream && o )                   = delete;
+            BinaryFetchStream & operator =( const BinaryFetchStream & o ) = delete;
+            BinaryFetchStream & operator =( BinaryFetchStream && o )      = delete;
+            
+            using BinaryStream::Read;
+            
+            void   Read( uint8_t * buf, size_t size )               override;
+            void   Seek( std::streamoff offset, SeekDirection dir ) override;
+            size_t Tell()                                     const override;
+            size_t Size()                                     const override;
+            
+            void ReadAt( uint64_t offset, uint8_t * buf, size_t size ) const override;
+            
+            const uint8_t * GetContiguousBytes( size_t size ) override;
+            
+            size_t GetBlockSize()  const;
+            size_t GetBlockCount() const;
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* ISOBMFF_BINARY_FETCH_STREAM_HPP */
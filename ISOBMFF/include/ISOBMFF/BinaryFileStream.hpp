@@ -44,20 +44,57 @@ namespace ISOBMFF
     {
         public:
             
+            /*!
+             * @var         DefaultBufferSize
+             * @abstract    Default size of the read-ahead buffer, in bytes.
+             */
+            static const size_t DefaultBufferSize = 64 * 1024;
+            
             BinaryFileStream( const std::string & path );
             
+            /*!
+             * @function    BinaryFileStream
+             * @abstract    Creates a file stream with a specific buffer size.
+             * @param       path        The file's path.
+             * @param       bufferSize  The size of the read-ahead buffer, in bytes.
+             * @discussion  Reads within the buffered window never reach the
+             *              underlying file.
+             *              Reads larger than the buffer bypass it, so a size
+             *              of zero disables buffering.
+             */
+            BinaryFileStream( const std::string & path, size_t bufferSize );
+            
+            /*!
+             * @function    BinaryFileStream
+             * @abstract    Creates another cursor on an open file stream.
+             * @param       o   The stream to copy.
+             * @discussion  The copy shares the open file with the original,
+             *              but has its own position and read-ahead buffer,
+             *              so copies can be read from different threads
+             *              without reopening the file.
+             */
+            BinaryFileStream( const BinaryFileStream & o );
+            BinaryFileStream( BinaryFileStream && o ) noexcept;
+            
             virtual ~BinaryFileStream() override;
             
-            BinaryFileStream( const BinaryFileStream & o )              = delete;
-            BinaryFileStream( BinaryFileStream && o )                   = delete;
-            BinaryFileStream & operator =( const BinaryFileStream & o ) = delete;
-            BinaryFileStream & operator =( BinaryFileStream && o )      = delete;
+            BinaryFileStream & operator =( BinaryFileStream o );
             
             using BinaryStream::Read;
             
             void   Read( uint8_t * buf, size_t size )               override;
             void   Seek( std::streamoff offset, SeekDirection dir ) override;
             size_t Tell()                                     const override;
+            size_t Size()                                     const override;
+            
+            void ReadAt( uint64_t offset, uint8_t * buf, size_t size ) const override;
+            
+            void            Get( uint8_t * buf, uint64_t pos, size_t length ) override;
+            const uint8_t * GetContiguousBytes( size_t size )                 override;
+            
+            size_t GetBufferSize() const;
+            
+            ISOBMFF_EXPORT friend void swap( BinaryFileStream & o1, BinaryFileStream & o2 );
             
         private:
             
@@ -0,0 +1,92 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      BinarySliceStream.hpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#ifndef ISOBMFF_BINARY_SLICE_STREAM_HPP
+#define ISOBMFF_BINARY_SLICE_STREAM_HPP
+
+#include <ISOBMFF/BinaryStream.hpp>
+#include <string>
+#include <iostream>
+#include <cstdint>
+#include <memory>
+#include <algorithm>
+
+namespace ISOBMFF
+{
+    /*!
+     * @class       BinarySliceStream
+     * @abstract    Bounded view on a range of another binary stream.
+     * @discussion  A slice exposes only `[offset, offset + length)` of its
+     *              parent stream, and reads directly from it, without copying
+     *              any data. Seeking or reading outside of the slice bounds
+     *              is an error.
+     *              Slices of slices always refer to the outermost stream.
+     *              The parent stream must outlive the slice, and its
+     *              position is undefined after reading from the slice.
+     */
+    class ISOBMFF_EXPORT BinarySliceStream: public BinaryStream
+    {
+        public:
+            
+            BinarySliceStream( BinaryStream & stream, uint64_t offset, uint64_t length );
+            BinarySliceStream( const BinarySliceStream & o );
+            BinarySliceStream( BinarySliceStream && o ) noexcept;
+            
+            virtual ~BinarySliceStream() override;
+            
+            BinarySliceStream & operator =( BinarySliceStream o );
+            
+            using BinaryStream::Read;
+            
+            void   Read( uint8_t * buf, size_t size )               override;
+            void   Seek( std::streamoff offset, SeekDirection dir ) override;
+            size_t Tell()                                     const override;
+            size_t Size()                                     const override;
+            
+            void     ReadAt( uint64_t offset, uint8_t * buf, size_t size ) const override;
+            DataView ReadViewAt( uint64_t offset, size_t size )            const override;
+            
+            const uint8_t * GetContiguousBytes( size_t size ) override;
+            DataView        ReadView( size_t size )           override;
+            
+            uint64_t GetOffset() const;
+            uint64_t GetLength() const;
+            
+            ISOBMFF_EXPORT friend void swap( BinarySliceStream & o1, BinarySliceStream & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* ISOBMFF_BINARY_SLICE_STREAM_HPP */
@@ -38,6 +38,7 @@
 #include <ISOBMFF/Casts.hpp>
 #include <ISOBMFF/Macros.hpp>
 #include <ISOBMFF/Matrix.hpp>
+#include <ISOBMFF/DataView.hpp>
 
 namespace ISOBMFF
 {
@@ -58,6 +59,30 @@ namespace ISOBMFF
             virtual size_t Tell()                                     const = 0;
             virtual void   Seek( std::streamoff offset, SeekDirection dir ) = 0;
             
+            /*!
+             * @function    Size
+             * @abstract    Gets the total number of bytes of the stream.
+             * @discussion  The default implementation seeks to the end of the
+             *              stream and back to the current position.
+             *              Streams that know their size should override it.
+             */
+            virtual size_t Size() const;
+            
+            /*!
+             * @function    ReadAt
+             * @abstract    Reads data at an absolute offset.
+             * @param       offset  The offset to read from.
+             * @param       buf     The buffer to read into.
+             * @param       size    The number of bytes to read.
+             * @discussion  The stream's position is preserved.
+             *              The default implementation seeks to the offset,
+             *              reads and seeks back, so it is not thread-safe.
+             *              The library's streams override it with positional
+             *              reads, which may be called concurrently from
+             *              several threads.
+             */
+            virtual void ReadAt( uint64_t offset, uint8_t * buf, size_t size ) const;
+            
             bool   HasBytesAvailable();
             size_t AvailableBytes();
             
@@ -75,7 +100,43 @@ namespace ISOBMFF
                 this->Seek( numeric_cast< std::streamoff >( offset ), dir );
             }
             
-            void Get( uint8_t * buf, uint64_t pos, size_t length );
+            virtual void Get( uint8_t * buf, uint64_t pos, size_t length );
+            
+            /*!
+             * @function    GetContiguousBytes
+             * @abstract    Exposes the next bytes of the stream as contiguous memory.
+             * @param       size    The number of bytes needed.
+             * @result      A pointer to the bytes at the current position, or
+             *              nullptr if the stream can't expose them.
+             * @discussion  The position is not changed. The pointer is only
+             *              valid until the stream is used again.
+             *              The default implementation returns nullptr.
+             */
+            virtual const uint8_t * GetContiguousBytes( size_t size );
+            
+            /*!
+             * @function    ReadView
+             * @abstract    Reads data as a view.
+             * @param       size    The number of bytes to read.
+             * @result      A view on the bytes read.
+             * @discussion  Streams backed by shared memory return a view on
+             *              that memory, without copying the bytes.
+             *              The default implementation reads the bytes into
+             *              a new buffer.
+             */
+            virtual DataView ReadView( size_t size );
+            
+            /*!
+             * @function    ReadViewAt
+             * @abstract    Reads data at an absolute offset, as a view.
+             * @param       offset  The offset to read from.
+             * @param       size    The number of bytes to read.
+             * @result      A view on the bytes read.
+             * @discussion  Like ReadAt, preserves the stream's position, and
+             *              may be called concurrently if ReadAt may.
+             * @see         ReadView
+             */
+            virtual DataView ReadViewAt( uint64_t offset, size_t size ) const;
             
             std::vector< uint8_t > Read( size_t size );
             std::vector< uint8_t > ReadAllData();
@@ -95,6 +156,19 @@ namespace ISOBMFF
             uint64_t ReadBigEndianUInt64();
             uint64_t ReadLittleEndianUInt64();
             
+            /*!
+             * @function    ReadBigEndianUInt32Array
+             * @abstract    Reads an array of big-endian values.
+             * @param       out     The values to fill.
+             * @param       n       The number of values to read.
+             * @discussion  The whole array is read at once, and converted in
+             *              place to the host byte order.
+             *              Variants exist for 16, 32 and 64 bits values.
+             */
+            void ReadBigEndianUInt16Array( uint16_t * out, size_t n );
+            void ReadBigEndianUInt32Array( uint32_t * out, size_t n );
+            void ReadBigEndianUInt64Array( uint64_t * out, size_t n );
+            
             float ReadBigEndianFixedPoint( unsigned int integerLength, unsigned int fractionalLength );
             float ReadLittleEndianFixedPoint( unsigned int integerLength, unsigned int fractionalLength );
             
@@ -35,11 +35,15 @@
 #include <algorithm>
 #include <ISOBMFF/Macros.hpp>
 #include <ISOBMFF/BinaryStream.hpp>
+#include <ISOBMFF/BinaryDataReader.hpp>
+#include <ISOBMFF/FourCC.hpp>
+#include <ISOBMFF/DataView.hpp>
 #include <ISOBMFF/DisplayableObject.hpp>
 #include <string>
 #include <ostream>
 #include <vector>
 #include <utility>
+#include <functional>
 
 namespace ISOBMFF
 {
@@ -94,6 +98,14 @@ namespace ISOBMFF
              */
             std::string GetName() const override;
             
+            /*!
+             * @function    GetType
+             * @abstract    Gets the box type.
+             * @result      The box type, or an empty code if the box name
+             *              isn't four characters long.
+             */
+            FourCC GetType() const;
+            
             /*!
              * @function    GetDisplayableProperties
              * @abstract    Gets the box displayable properties.
@@ -118,6 +130,45 @@ namespace ISOBMFF
              */
             virtual std::vector< uint8_t > GetData() const;
             
+            /*!
+             * @function    GetDataView
+             * @abstract    Gets the box data, without copying it.
+             * @result      A view on the box data.
+             * @discussion  When the file was parsed from memory or from a
+             *              memory-mapped file, the view shares the parsed
+             *              data rather than a copy of it.
+             */
+            virtual DataView GetDataView() const;
+            
+            /*!
+             * @function    SetLazyData
+             * @abstract    Defers reading the box data until the box is loaded.
+             * @param       read    A function reading the box data.
+             * @discussion  Used by the parser when the LazyParsing option is
+             *              set. The function is called once, by Load().
+             * @see         Load
+             */
+            void SetLazyData( const std::function< void( Box & ) > & read );
+            
+            /*!
+             * @function    IsLoaded
+             * @abstract    Checks if the box data has been read.
+             * @result      false if reading the box data was deferred and the
+             *              box was not loaded yet, otherwise true.
+             */
+            bool IsLoaded() const;
+            
+            /*!
+             * @function    Load
+             * @abstract    Reads the box data, if reading it was deferred.
+             * @discussion  Called by the getters and setters of the box
+             *              classes, so it only needs to be called explicitly
+             *              to read the data ahead of time.
+             *              This method is not thread-safe.
+             * @see         SetLazyData
+             */
+            void Load() const;
+            
             /*!
              * @function    swap
              * @abstract    Swap two objects.
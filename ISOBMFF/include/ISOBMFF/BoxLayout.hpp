@@ -0,0 +1,234 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @header      BoxLayout.hpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#ifndef ISOBMFF_BOX_LAYOUT_HPP
+#define ISOBMFF_BOX_LAYOUT_HPP
+
+#include <memory>
+#include <algorithm>
+#include <ISOBMFF/Macros.hpp>
+#include <ISOBMFF/BinaryStream.hpp>
+#include <ISOBMFF/FourCC.hpp>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace ISOBMFF
+{
+    class Parser;
+    
+    /*!
+     * @class       BoxLayout
+     * @abstract    Flat list of the boxes in an ISO media file.
+     * @discussion  Only box headers are read, and no box object is
+     *              created. Child boxes are listed after their container,
+     *              with a greater depth. Container box types are taken
+     *              from the parser's registry.
+     */
+    class ISOBMFF_EXPORT BoxLayout
+    {
+        public:
+            
+            /*!
+             * @class       Entry
+             * @abstract    Box header found in a file.
+             */
+            class ISOBMFF_EXPORT Entry
+            {
+                public:
+                    
+                    Entry( FourCC type, uint64_t offset, uint64_t size, uint32_t headerSize, uint32_t depth, bool truncated );
+                    
+                    /*!
+                     * @function    GetType
+                     * @abstract    Gets the box type.
+                     */
+                    FourCC GetType() const;
+                    
+                    /*!
+                     * @function    GetOffset
+                     * @abstract    Gets the offset of the box, from the start of the file.
+                     */
+                    uint64_t GetOffset() const;
+                    
+                    /*!
+                     * @function    GetSize
+                     * @abstract    Gets the box size, including its header.
+                     * @discussion  For truncated boxes, this is the declared size.
+                     */
+                    uint64_t GetSize() const;
+                    
+                    /*!
+                     * @function    GetHeaderSize
+                     * @abstract    Gets the size of the box header.
+                     * @discussion  This includes the 64-bits size and the UUID
+                     *              extended type, if present.
+                     */
+                    uint32_t GetHeaderSize() const;
+                    
+                    /*!
+                     * @function    GetDepth
+                     * @abstract    Gets the box depth, 0 for top-level boxes.
+                     */
+                    uint32_t GetDepth() const;
+                    
+                    /*!
+                     * @function    IsTruncated
+                     * @abstract    Checks if the box extends past the end of its
+                     *              container, or has an invalid size.
+                     */
+                    bool IsTruncated() const;
+                    
+                private:
+                    
+                    FourCC   _type;
+                    uint64_t _offset;
+                    uint64_t _size;
+                    uint32_t _headerSize;
+                    uint32_t _depth;
+                    bool     _truncated;
+            };
+            
+            /*!
+             * @function    BoxLayout
+             * @abstract    Default constructor.
+             */
+            BoxLayout();
+            
+            /*!
+             * @function    BoxLayout
+             * @abstract    Scans a file.
+             * @param       path    The file's path.
+             */
+            BoxLayout( const std::string & path );
+            
+            /*!
+             * @function    BoxLayout
+             * @abstract    Scans a stream, with the default box types.
+             * @param       stream  The stream object.
+             */
+            BoxLayout( BinaryStream & stream );
+            
+            /*!
+             * @function    BoxLayout
+             * @abstract    Scans a stream, with the box types of a parser.
+             * @param       parser  The parser whose registered box types are used.
+             * @param       stream  The stream object.
+             */
+            BoxLayout( const Parser & parser, BinaryStream & stream );
+            
+            /*!
+             * @function    BoxLayout
+             * @abstract    Copy constructor.
+             * @param       o   The object to copy from.
+             */
+            BoxLayout( const BoxLayout & o );
+            
+            /*!
+             * @function    BoxLayout
+             * @abstract    Move constructor.
+             * @param       o   The object to move from.
+             */
+            BoxLayout( BoxLayout && o ) noexcept;
+            
+            /*!
+             * @function    ~BoxLayout
+             * @abstract    Destructor.
+             */
+            virtual ~BoxLayout();
+            
+            /*!
+             * @function    operator=
+             * @abstract    Assignment operator.
+             * @param       o   The object to assign from.
+             */
+            BoxLayout & operator =( BoxLayout o );
+            
+            /*!
+             * @function    Scan
+             * @abstract    Scans a stream, with the box types of a parser.
+             * @param       parser  The parser whose registered box types are used.
+             * @param       stream  The stream object.
+             * @discussion  This will discard any previously scanned entries.
+             *              Headers are read with ReadAt, so the stream
+             *              position is not modified.
+             */
+            void Scan( const Parser & parser, BinaryStream & stream );
+            
+            /*!
+             * @function    GetEntries
+             * @abstract    Gets the scanned boxes, in file order.
+             * @result      The box entries.
+             */
+            const std::vector< Entry > & GetEntries() const;
+            
+            /*!
+             * @function    IsTruncated
+             * @abstract    Checks if the scanned file is truncated.
+             * @result      true if a box extends past the end of its container,
+             *              or the file ends with a partial box header.
+             */
+            bool IsTruncated() const;
+            
+            /*!
+             * @function    ReadEntry
+             * @abstract    Reads a single box header.
+             * @param       stream  The stream object.
+             * @param       offset  The offset of the box, from the start of the stream.
+             * @param       end     The end offset of the box's container.
+             * @param       depth   The box depth, 0 for top-level boxes.
+             * @result      The box entry. It is truncated if the header or
+             *              the box extends past the end of its container.
+             * @discussion  The header is read with ReadAt, so the stream
+             *              position is not modified. A size of 0 means up
+             *              to the end of the container for top-level boxes.
+             *              Throws an exception if there are less than 8
+             *              bytes before the end of the container.
+             */
+            static Entry ReadEntry( BinaryStream & stream, uint64_t offset, uint64_t end, uint32_t depth );
+            
+            /*!
+             * @function    swap
+             * @abstract    Swap two objects.
+             * @param       o1  The first object to swap.
+             * @param       o2  The second object to swap.
+             */
+            ISOBMFF_EXPORT friend void swap( BoxLayout & o1, BoxLayout & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* ISOBMFF_BOX_LAYOUT_HPP */
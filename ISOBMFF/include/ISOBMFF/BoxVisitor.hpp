@@ -0,0 +1,235 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @header      BoxVisitor.hpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#ifndef ISOBMFF_BOX_VISITOR_HPP
+#define ISOBMFF_BOX_VISITOR_HPP
+
+#include <ISOBMFF/Macros.hpp>
+#include <ISOBMFF/FourCC.hpp>
+#include <cstdint>
+
+namespace ISOBMFF
+{
+    class Box;
+    class FTYP;
+    class MVHD;
+    class TKHD;
+    class HDLR;
+    class PITM;
+    class ILOC;
+    class INFE;
+    class IROT;
+    class HVCC;
+    class COLR;
+    class ISPE;
+    class IPMA;
+    class PIXI;
+    class SIDX;
+    class MFHD;
+    class TFHD;
+    class TREX;
+    
+    /*!
+     * @class       BoxVisitor
+     * @abstract    Interface receiving the boxes found while visiting a file.
+     * @discussion  Callbacks are invoked in file order, while the file is
+     *              parsed, and no box is retained once its callbacks
+     *              have returned. All callbacks do nothing by default.
+     * @see         Parser::Visit
+     */
+    class ISOBMFF_EXPORT BoxVisitor
+    {
+        public:
+            
+            BoxVisitor()                                  = default;
+            BoxVisitor( const BoxVisitor & )              = default;
+            BoxVisitor & operator =( const BoxVisitor & ) = default;
+            
+            /*!
+             * @function    ~BoxVisitor
+             * @abstract    Destructor.
+             */
+            virtual ~BoxVisitor();
+            
+            /*!
+             * @function    OnBoxBegin
+             * @abstract    Called when a box is found, before reading its data.
+             * @param       type    The box type.
+             * @param       offset  The offset of the box, from the start of the file.
+             * @param       size    The box size, including its header.
+             * @param       depth   The box depth, 0 for top-level boxes.
+             * @result      true to read the box data and its child boxes,
+             *              false to skip them.
+             */
+            virtual bool OnBoxBegin( FourCC type, uint64_t offset, uint64_t size, uint32_t depth );
+            
+            /*!
+             * @function    OnBoxEnd
+             * @abstract    Called after the data of a box, and its child
+             *              boxes, have been read or skipped.
+             * @param       type    The box type.
+             * @param       depth   The box depth, 0 for top-level boxes.
+             */
+            virtual void OnBoxEnd( FourCC type, uint32_t depth );
+            
+            /*!
+             * @function    OnBox
+             * @abstract    Called for each box decoded by a registered box class.
+             * @param       box     The box, with its data read. Container
+             *              boxes have no child boxes.
+             * @discussion  This is called before OnBoxEnd. The default
+             *              implementation invokes the typed callback
+             *              matching the box class, if any.
+             */
+            virtual void OnBox( const Box & box );
+            
+            /*!
+             * @function    OnFTYP
+             * @abstract    Called for each decoded FTYP box.
+             * @param       box     The box.
+             */
+            virtual void OnFTYP( const FTYP & box );
+            
+            /*!
+             * @function    OnMVHD
+             * @abstract    Called for each decoded MVHD box.
+             * @param       box     The box.
+             */
+            virtual void OnMVHD( const MVHD & box );
+            
+            /*!
+             * @function    OnTKHD
+             * @abstract    Called for each decoded TKHD box.
+             * @param       box     The box.
+             */
+            virtual void OnTKHD( const TKHD & box );
+            
+            /*!
+             * @function    OnHDLR
+             * @abstract    Called for each decoded HDLR box.
+             * @param       box     The box.
+             */
+            virtual void OnHDLR( const HDLR & box );
+            
+            /*!
+             * @function    OnPITM
+             * @abstract    Called for each decoded PITM box.
+             * @param       box     The box.
+             */
+            virtual void OnPITM( const PITM & box );
+            
+            /*!
+             * @function    OnILOC
+             * @abstract    Called for each decoded ILOC box.
+             * @param       box     The box.
+             */
+            virtual void OnILOC( const ILOC & box );
+            
+            /*!
+             * @function    OnINFE
+             * @abstract    Called for each decoded INFE box.
+             * @param       box     The box.
+             */
+            virtual void OnINFE( const INFE & box );
+            
+            /*!
+             * @function    OnIROT
+             * @abstract    Called for each decoded IROT box.
+             * @param       box     The box.
+             */
+            virtual void OnIROT( const IROT & box );
+            
+            /*!
+             * @function    OnHVCC
+             * @abstract    Called for each decoded HVCC box.
+             * @param       box     The box.
+             */
+            virtual void OnHVCC( const HVCC & box );
+            
+            /*!
+             * @function    OnCOLR
+             * @abstract    Called for each decoded COLR box.
+             * @param       box     The box.
+             */
+            virtual void OnCOLR( const COLR & box );
+            
+            /*!
+             * @function    OnISPE
+             * @abstract    Called for each decoded ISPE box.
+             * @param       box     The box.
+             */
+            virtual void OnISPE( const ISPE & box );
+            
+            /*!
+             * @function    OnIPMA
+             * @abstract    Called for each decoded IPMA box.
+             * @param       box     The box.
+             */
+            virtual void OnIPMA( const IPMA & box );
+            
+            /*!
+             * @function    OnPIXI
+             * @abstract    Called for each decoded PIXI box.
+             * @param       box     The box.
+             */
+            virtual void OnPIXI( const PIXI & box );
+            
+            /*!
+             * @function    OnSIDX
+             * @abstract    Called for each decoded SIDX box.
+             * @param       box     The box.
+             */
+            virtual void OnSIDX( const SIDX & box );
+            
+            /*!
+             * @function    OnMFHD
+             * @abstract    Called for each decoded MFHD box.
+             * @param       box     The box.
+             */
+            virtual void OnMFHD( const MFHD & box );
+            
+            /*!
+             * @function    OnTFHD
+             * @abstract    Called for each decoded TFHD box.
+             * @param       box     The box.
+             */
+            virtual void OnTFHD( const TFHD & box );
+            
+            /*!
+             * @function    OnTREX
+             * @abstract    Called for each decoded TREX box.
+             * @param       box     The box.
+             */
+            virtual void OnTREX( const TREX & box );
+    };
+}
+
+#endif /* ISOBMFF_BOX_VISITOR_HPP */
@@ -61,6 +61,7 @@ namespace ISOBMFF
             uint16_t               GetMatrixCoefficients()      const;
             bool                   GetFullRangeFlag()           const;
             std::vector< uint8_t > GetICCProfile()              const;
+            DataView               GetICCProfileView()          const;
             
             void SetColourType( const std::string & value );
             void SetColourPrimaries( uint16_t value );
@@ -68,6 +69,7 @@ namespace ISOBMFF
             void SetMatrixCoefficients( uint16_t value );
             void SetFullRangeFlag( bool value );
             void SetICCProfile( const std::vector< uint8_t > & value );
+            void SetICCProfile( const DataView & value );
             
             ISOBMFF_EXPORT friend void swap( COLR & o1, COLR & o2 );
             
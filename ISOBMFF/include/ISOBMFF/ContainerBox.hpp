@@ -60,6 +60,29 @@ namespace ISOBMFF
             
             ISOBMFF_EXPORT friend void swap( ContainerBox & o1, ContainerBox & o2 );
             
+        protected:
+            
+            /*!
+             * @function    CreateChildBox
+             * @abstract    Creates a box for a child of the container.
+             * @param       parser  The parser currently being used.
+             * @param       type    The type of the child box.
+             * @result      The child box.
+             * @discussion  The default implementation creates the box
+             *              registered in the parser for the type.
+             */
+            virtual std::shared_ptr< Box > CreateChildBox( const Parser & parser, FourCC type ) const;
+            
+            /*!
+             * @function    HasIndexedBoxes
+             * @abstract    Checks if child boxes are referenced by their index.
+             * @result      true if child boxes are referenced by their index.
+             * @discussion  Child boxes skipped by path filters are then kept
+             *              as unread boxes, so the other boxes keep their
+             *              index. The default implementation returns false.
+             */
+            virtual bool HasIndexedBoxes() const;
+            
         private:
             
             class IMPL;
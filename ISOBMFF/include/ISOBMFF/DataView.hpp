@@ -0,0 +1,177 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      DataView.hpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#ifndef ISOBMFF_DATA_VIEW_HPP
+#define ISOBMFF_DATA_VIEW_HPP
+
+#include <ISOBMFF/Macros.hpp>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+namespace ISOBMFF
+{
+    /*!
+     * @class       DataView
+     * @abstract    Read-only view on a range of bytes.
+     * @discussion  The bytes are kept alive by a shared owner, like the
+     *              data of a stream or a memory mapping, so views can be
+     *              copied and kept around without copying the bytes.
+     *              Keeping a view also keeps its whole owner alive.
+     */
+    class DataView
+    {
+        public:
+            
+            /*!
+             * @function    DataView
+             * @abstract    Creates an empty view.
+             */
+            DataView():
+                _data( nullptr ),
+                _size( 0 )
+            {}
+            
+            /*!
+             * @function    DataView
+             * @abstract    Creates a view on bytes kept alive by an owner.
+             * @param       owner   The object owning the bytes.
+             * @param       data    The first byte of the view.
+             * @param       size    The number of bytes.
+             */
+            DataView( std::shared_ptr< const void > owner, const uint8_t * data, size_t size ):
+                _owner( std::move( owner ) ),
+                _data( ( size > 0 ) ? data : nullptr ),
+                _size( size )
+            {
+                if( data == nullptr && size > 0 )
+                {
+                    throw std::runtime_error( "Invalid data" );
+                }
+            }
+            
+            /*!
+             * @function    DataView
+             * @abstract    Creates a view owning a vector of bytes.
+             * @param       data    The bytes, which are moved, not copied.
+             */
+            explicit DataView( std::vector< uint8_t > data ):
+                DataView()
+            {
+                std::shared_ptr< const std::vector< uint8_t > > v;
+                
+                if( data.size() == 0 )
+                {
+                    return;
+                }
+                
+                v            = std::make_shared< const std::vector< uint8_t > >( std::move( data ) );
+                this->_data  = v->data();
+                this->_size  = v->size();
+                this->_owner = std::move( v );
+            }
+            
+            /*!
+             * @function    GetBytes
+             * @abstract    Gets the viewed bytes.
+             * @result      A pointer to the first byte, or nullptr if the view is empty.
+             */
+            const uint8_t * GetBytes() const
+            {
+                return this->_data;
+            }
+            
+            /*!
+             * @function    GetSize
+             * @abstract    Gets the number of viewed bytes.
+             * @result      The number of bytes.
+             */
+            size_t GetSize() const
+            {
+                return this->_size;
+            }
+            
+            /*!
+             * @function    IsEmpty
+             * @abstract    Checks if the view has no bytes.
+             * @result      true if the view is empty, otherwise false.
+             */
+            bool IsEmpty() const
+            {
+                return this->_size == 0;
+            }
+            
+            /*!
+             * @function    GetSubView
+             * @abstract    Gets a view on a part of the bytes, sharing the same owner.
+             * @param       offset  The offset of the first byte.
+             * @param       size    The number of bytes.
+             * @result      The sub-view.
+             */
+            DataView GetSubView( size_t offset, size_t size ) const
+            {
+                if( offset > this->_size || size > this->_size - offset )
+                {
+                    throw std::runtime_error( "Invalid data view range" );
+                }
+                
+                return DataView( this->_owner, ( size > 0 ) ? this->_data + offset : nullptr, size );
+            }
+            
+            /*!
+             * @function    GetVector
+             * @abstract    Copies the viewed bytes.
+             * @result      A vector with a copy of the bytes.
+             */
+            std::vector< uint8_t > GetVector() const
+            {
+                return std::vector< uint8_t >( this->begin(), this->end() );
+            }
+            
+            const uint8_t * begin() const { return this->_data; }
+            const uint8_t * end()   const { return this->_data + this->_size; }
+            
+            uint8_t operator []( size_t i ) const
+            {
+                return this->_data[ i ];
+            }
+            
+        private:
+            
+            std::shared_ptr< const void > _owner;
+            const uint8_t               * _data;
+            size_t                        _size;
+    };
+}
+
+#endif /* ISOBMFF_DATA_VIEW_HPP */
@@ -0,0 +1,312 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @header      FlatFile.hpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#ifndef ISOBMFF_FLAT_FILE_HPP
+#define ISOBMFF_FLAT_FILE_HPP
+
+#include <memory>
+#include <algorithm>
+#include <ISOBMFF/Macros.hpp>
+#include <ISOBMFF/BinaryStream.hpp>
+#include <ISOBMFF/Box.hpp>
+#include <ISOBMFF/FourCC.hpp>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace ISOBMFF
+{
+    class Parser;
+    
+    /*!
+     * @class       FlatFile
+     * @abstract    Compact, read-only representation of a parsed ISO media file.
+     * @discussion  Boxes are stored as nodes in a single array, in file
+     *              order, linked by indices rather than pointers.
+     *              Boxes without children are decoded with the registered
+     *              box classes, and kept in a table per box type, while
+     *              container boxes are only represented by their node.
+     *              Decoded boxes remain separate objects, shared by the
+     *              copies of a flat file.
+     *              Once parsed, a flat file is never modified, so it can be
+     *              copied and shared between threads.
+     */
+    class ISOBMFF_EXPORT FlatFile
+    {
+        public:
+            
+            /*!
+             * @constant    NoNode
+             * @abstract    Index used when a node has no parent, child or sibling,
+             *              or no decoded box.
+             */
+            static const uint32_t NoNode = UINT32_MAX;
+            
+            /*!
+             * @class       Node
+             * @abstract    Box found in a file.
+             */
+            class ISOBMFF_EXPORT Node
+            {
+                public:
+                    
+                    Node( FourCC type, uint64_t offset, uint64_t size, uint32_t parent, uint32_t depth );
+                    
+                    /*!
+                     * @function    GetType
+                     * @abstract    Gets the box type.
+                     */
+                    FourCC GetType() const;
+                    
+                    /*!
+                     * @function    GetOffset
+                     * @abstract    Gets the offset of the box, from the start of the file.
+                     */
+                    uint64_t GetOffset() const;
+                    
+                    /*!
+                     * @function    GetSize
+                     * @abstract    Gets the box size, including its header.
+                     */
+                    uint64_t GetSize() const;
+                    
+                    /*!
+                     * @function    GetParent
+                     * @abstract    Gets the index of the parent node, or NoNode.
+                     */
+                    uint32_t GetParent() const;
+                    
+                    /*!
+                     * @function    GetFirstChild
+                     * @abstract    Gets the index of the first child node, or NoNode.
+                     */
+                    uint32_t GetFirstChild() const;
+                    
+                    /*!
+                     * @function    GetNextSibling
+                     * @abstract    Gets the index of the next sibling node, or NoNode.
+                     */
+                    uint32_t GetNextSibling() const;
+                    
+                    /*!
+                     * @function    GetDepth
+                     * @abstract    Gets the box depth, 0 for top-level boxes.
+                     */
+                    uint32_t GetDepth() const;
+                    
+                    /*!
+                     * @function    GetBoxIndex
+                     * @abstract    Gets the index of the decoded box, in the boxes
+                     *              of the same type, or NoNode.
+                     * @see         FlatFile::GetBoxes
+                     */
+                    uint32_t GetBoxIndex() const;
+                    
+                private:
+                    
+                    friend class FlatFile;
+                    
+                    FourCC   _type;
+                    uint64_t _offset;
+                    uint64_t _size;
+                    uint32_t _parent;
+                    uint32_t _firstChild;
+                    uint32_t _nextSibling;
+                    uint32_t _depth;
+                    uint32_t _box;
+            };
+            
+            /*!
+             * @function    FlatFile
+             * @abstract    Default constructor.
+             */
+            FlatFile();
+            
+            /*!
+             * @function    FlatFile
+             * @abstract    Parses a file.
+             * @param       path    The file's path.
+             */
+            FlatFile( const std::string & path );
+            
+            /*!
+             * @function    FlatFile
+             * @abstract    Parses a stream, with the default box types.
+             * @param       stream  The stream object.
+             */
+            FlatFile( BinaryStream & stream );
+            
+            /*!
+             * @function    FlatFile
+             * @abstract    Parses a stream, with a parser's box types and options.
+             * @param       parser  The parser whose box types, options and path filters are used.
+             * @param       stream  The stream object.
+             */
+            FlatFile( const Parser & parser, BinaryStream & stream );
+            
+            /*!
+             * @function    FlatFile
+             * @abstract    Copy constructor.
+             * @param       o   The object to copy from.
+             */
+            FlatFile( const FlatFile & o );
+            
+            /*!
+             * @function    FlatFile
+             * @abstract    Move constructor.
+             * @param       o   The object to move from.
+             */
+            FlatFile( FlatFile && o ) noexcept;
+            
+            /*!
+             * @function    ~FlatFile
+             * @abstract    Destructor.
+             */
+            virtual ~FlatFile();
+            
+            /*!
+             * @function    operator=
+             * @abstract    Assignment operator.
+             * @param       o   The object to assign from.
+             */
+            FlatFile & operator =( FlatFile o );
+            
+            /*!
+             * @function    Parse
+             * @abstract    Parses a stream, with a parser's box types and options.
+             * @param       parser  The parser whose box types, options and path filters are used.
+             * @param       stream  The stream object.
+             * @discussion  This will discard any previously parsed nodes.
+             *              The parser itself is not modified, and boxes are
+             *              always read immediately, even if its LazyParsing
+             *              option is set. The data of boxes with no
+             *              registered class is not read, and MDAT boxes only
+             *              record the range of their data.
+             */
+            void Parse( const Parser & parser, BinaryStream & stream );
+            
+            /*!
+             * @function    GetNodes
+             * @abstract    Gets all nodes, in file order.
+             * @result      The nodes. Child nodes follow their parent node.
+             */
+            const std::vector< Node > & GetNodes() const;
+            
+            /*!
+             * @function    FindNodes
+             * @abstract    Finds the nodes of a box type.
+             * @param       type    The box type.
+             * @result      The indices of the nodes, in file order.
+             */
+            std::vector< uint32_t > FindNodes( FourCC type ) const;
+            
+            /*!
+             * @function    FindNodes
+             * @abstract    Finds the nodes matching a box path.
+             * @param       path    The box path, like "trak/tkhd".
+             * @result      The indices of the nodes, in file order.
+             * @discussion  The path is matched against the last boxes of each
+             *              node's path, so "trak/tkhd" finds the TKHD boxes
+             *              of all tracks.
+             */
+            std::vector< uint32_t > FindNodes( const std::string & path ) const;
+            
+            /*!
+             * @function    GetBox
+             * @abstract    Gets the decoded box of a node.
+             * @param       node    The node index.
+             * @result      The box, or nullptr if the node has no decoded box.
+             */
+            std::shared_ptr< const Box > GetBox( uint32_t node ) const;
+            
+            /*!
+             * @function    GetTypedBox
+             * @abstract    Gets the decoded box of a node, with a specific type.
+             * @param       node    The node index.
+             * @result      The box, or nullptr if the node has no decoded box
+             *              or if the box is not of the correct type.
+             */
+            template< class _T_ >
+            std::shared_ptr< const _T_ > GetTypedBox( uint32_t node ) const
+            {
+                return std::dynamic_pointer_cast< const _T_ >( this->GetBox( node ) );
+            }
+            
+            /*!
+             * @function    GetBoxes
+             * @abstract    Gets all decoded boxes of a box type.
+             * @param       type    The box type.
+             * @result      The boxes, in file order.
+             */
+            const std::vector< std::shared_ptr< const Box > > & GetBoxes( FourCC type ) const;
+            
+            /*!
+             * @function    GetTypedBoxes
+             * @abstract    Gets all decoded boxes of a box type, with a specific type.
+             * @param       type    The box type.
+             * @result      The boxes, in file order. Boxes that are not of
+             *              the correct type are not included.
+             */
+            template< class _T_ >
+            std::vector< std::shared_ptr< const _T_ > > GetTypedBoxes( FourCC type ) const
+            {
+                std::vector< std::shared_ptr< const _T_ > > boxes;
+                
+                for( const auto & box: this->GetBoxes( type ) )
+                {
+                    std::shared_ptr< const _T_ > typed( std::dynamic_pointer_cast< const _T_ >( box ) );
+                    
+                    if( typed != nullptr )
+                    {
+                        boxes.push_back( typed );
+                    }
+                }
+                
+                return boxes;
+            }
+            
+            /*!
+             * @function    swap
+             * @abstract    Swap two objects.
+             * @param       o1  The first object to swap.
+             * @param       o2  The second object to swap.
+             */
+            ISOBMFF_EXPORT friend void swap( FlatFile & o1, FlatFile & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* ISOBMFF_FLAT_FILE_HPP */
@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @header      FourCC.hpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#ifndef ISOBMFF_FOUR_CC_HPP
+#define ISOBMFF_FOUR_CC_HPP
+
+#include <ISOBMFF/Macros.hpp>
+#include <string>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+
+namespace ISOBMFF
+{
+    /*!
+     * @class       FourCC
+     * @abstract    Four character code, like a box type.
+     * @discussion  Stored as a big-endian 32-bits integer, so codes can be
+     *              compared and hashed without string operations.
+     *              Codes can be created at compile time from literals:
+     *              
+     *                  constexpr FourCC ftyp( "ftyp" );
+     */
+    class FourCC
+    {
+        public:
+            
+            /*!
+             * @function    FourCC
+             * @abstract    Creates an empty code (all zeros).
+             */
+            constexpr FourCC():
+                _value( 0 )
+            {}
+            
+            /*!
+             * @function    FourCC
+             * @abstract    Creates a code from its integer value.
+             * @param       value   The big-endian integer value.
+             */
+            constexpr explicit FourCC( uint32_t value ):
+                _value( value )
+            {}
+            
+            /*!
+             * @function    FourCC
+             * @abstract    Creates a code from a four characters literal.
+             * @param       s   The four characters literal.
+             */
+            constexpr explicit FourCC( const char ( & s )[ 5 ] ):
+                _value
+                (
+                      ( static_cast< uint32_t >( static_cast< uint8_t >( s[ 0 ] ) ) << 24 )
+                    | ( static_cast< uint32_t >( static_cast< uint8_t >( s[ 1 ] ) ) << 16 )
+                    | ( static_cast< uint32_t >( static_cast< uint8_t >( s[ 2 ] ) ) <<  8 )
+                    | ( static_cast< uint32_t >( static_cast< uint8_t >( s[ 3 ] ) ) )
+                )
+            {}
+            
+            /*!
+             * @function    FourCC
+             * @abstract    Creates a code from a string.
+             * @param       s   The string, which must be four characters long.
+             */
+            explicit FourCC( const std::string & s ):
+                _value( 0 )
+            {
+                if( s.size() != 4 )
+                {
+                    throw std::runtime_error( "Invalid four character code: " + s );
+                }
+                
+                for( char c: s )
+                {
+                    this->_value = ( this->_value << 8 ) | static_cast< uint8_t >( c );
+                }
+            }
+            
+            /*!
+             * @function    GetValue
+             * @abstract    Gets the integer value of the code.
+             * @result      The big-endian integer value.
+             */
+            constexpr uint32_t GetValue() const
+            {
+                return this->_value;
+            }
+            
+            /*!
+             * @function    GetString
+             * @abstract    Gets the code as a four characters string.
+             * @result      The string value.
+             */
+            std::string GetString() const
+            {
+                char s[ 4 ] =
+                {
+                    static_cast< char >( this->_value >> 24 ),
+                    static_cast< char >( this->_value >> 16 ),
+                    static_cast< char >( this->_value >>  8 ),
+                    static_cast< char >( this->_value )
+                };
+                
+                return std::string( s, 4 );
+            }
+            
+            constexpr bool operator ==( const FourCC & o ) const { return this->_value == o._value; }
+            constexpr bool operator !=( const FourCC & o ) const { return this->_value != o._value; }
+            constexpr bool operator < ( const FourCC & o ) const { return this->_value <  o._value; }
+            
+        private:
+            
+            uint32_t _value;
+    };
+}
+
+namespace std
+{
+    template<>
+    struct hash< ISOBMFF::FourCC >
+    {
+        size_t operator()( const ISOBMFF::FourCC & type ) const noexcept
+        {
+            return std::hash< uint32_t >()( type.GetValue() );
+        }
+    };
+}
+
+#endif /* ISOBMFF_FOUR_CC_HPP */
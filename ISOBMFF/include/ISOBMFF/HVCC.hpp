@@ -134,8 +134,10 @@ namespace ISOBMFF
                             
                             std::string GetName() const override;
                             
-                            std::vector< uint8_t > GetData() const;
+                            std::vector< uint8_t > GetData()     const;
+                            DataView               GetDataView() const;
                             void                   SetData( const std::vector< uint8_t > & value );
+                            void                   SetData( const DataView & value );
                             
                             virtual std::vector< std::pair< std::string, std::string > > GetDisplayableProperties() const override;
                             
@@ -74,6 +74,7 @@ namespace ISOBMFF
                     
                     Item();
                     Item( BinaryStream & stream, const ILOC & iloc );
+                    Item( BinaryDataReader & stream, const ILOC & iloc );
                     Item( const Item & o );
                     Item( Item && o ) noexcept;
                     virtual ~Item() override;
@@ -103,6 +104,7 @@ namespace ISOBMFF
                             
                             Extent();
                             Extent( BinaryStream & stream, const ILOC & iloc );
+                            Extent( BinaryDataReader & stream, const ILOC & iloc );
                             Extent( const Extent & o );
                             Extent( Extent && o ) noexcept;
                             virtual ~Extent() override;
@@ -125,6 +127,9 @@ namespace ISOBMFF
                             
                         private:
                             
+                            template< typename T >
+                            void Read( T & stream, const ILOC & iloc );
+                            
                             class IMPL;
                             
                             std::unique_ptr< IMPL > impl;
@@ -137,6 +142,9 @@ namespace ISOBMFF
                     
                 private:
                     
+                    template< typename T >
+                    void Read( T & stream, const ILOC & iloc );
+                    
                     class IMPL;
                     
                     std::unique_ptr< IMPL > impl;
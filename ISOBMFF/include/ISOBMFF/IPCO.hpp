@@ -48,6 +48,10 @@ namespace ISOBMFF
             std::shared_ptr< Box >                GetPropertyAtIndex( size_t index ) const;
             std::shared_ptr< Box >                GetProperty( const IPMA::Entry::Association & association ) const;
             std::vector< std::shared_ptr< Box > > GetProperties( const IPMA::Entry & entry ) const;
+            
+        protected:
+            
+            bool HasIndexedBoxes() const override;
     };
 }
 
@@ -65,6 +65,7 @@ namespace ISOBMFF
                     
                     Entry();
                     Entry( BinaryStream & stream, const IPMA & ipma );
+                    Entry( BinaryDataReader & stream, const IPMA & ipma );
                     Entry( const Entry & o );
                     Entry( Entry && o ) noexcept;
                     virtual ~Entry() override;
@@ -87,6 +88,7 @@ namespace ISOBMFF
                             
                             Association();
                             Association( BinaryStream & stream, const IPMA & ipma );
+                            Association( BinaryDataReader & stream, const IPMA & ipma );
                             Association( const Association & o );
                             Association( Association && o ) noexcept;
                             virtual ~Association() override;
@@ -107,6 +109,9 @@ namespace ISOBMFF
                             
                         private:
                             
+                            template< typename T >
+                            void Read( T & stream, const IPMA & ipma );
+                            
                             class IMPL;
                             
                             std::unique_ptr< IMPL > impl;
@@ -119,6 +124,9 @@ namespace ISOBMFF
                     
                 private:
                     
+                    template< typename T >
+                    void Read( T & stream, const IPMA & ipma );
+                    
                     class IMPL;
                     
                     std::unique_ptr< IMPL > impl;
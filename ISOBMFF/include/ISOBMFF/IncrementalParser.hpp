@@ -0,0 +1,168 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @header      IncrementalParser.hpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#ifndef ISOBMFF_INCREMENTAL_PARSER_HPP
+#define ISOBMFF_INCREMENTAL_PARSER_HPP
+
+#include <memory>
+#include <algorithm>
+#include <ISOBMFF/Macros.hpp>
+#include <ISOBMFF/Box.hpp>
+#include <ISOBMFF/Parser.hpp>
+#include <functional>
+#include <cstdint>
+
+namespace ISOBMFF
+{
+    /*!
+     * @class       IncrementalParser
+     * @abstract    Push-mode parser, for data received in chunks.
+     * @discussion  Data is fed as it is received, and each top-level box
+     *              is parsed and passed to a callback as soon as it is
+     *              complete. Only the box in progress is buffered, so
+     *              memory is bounded by the size of the largest box.
+     *              The data of MDAT boxes is not buffered if the parser's
+     *              SkipMDATData option is set, and top-level boxes not
+     *              selected by the parser's path filters are skipped.
+     */
+    class ISOBMFF_EXPORT IncrementalParser
+    {
+        public:
+            
+            /*!
+             * @typedef     Callback
+             * @abstract    Function receiving the parsed top-level boxes.
+             */
+            using Callback = std::function< void( const std::shared_ptr< Box > & ) >;
+            
+            /*!
+             * @function    IncrementalParser
+             * @abstract    Creates an incremental parser, with the default box types.
+             * @param       callback    The function receiving the parsed top-level boxes.
+             */
+            IncrementalParser( const Callback & callback );
+            
+            /*!
+             * @function    IncrementalParser
+             * @abstract    Creates an incremental parser, with a parser's box types and options.
+             * @param       parser      The parser whose box types, options and path filters are used.
+             * @param       callback    The function receiving the parsed top-level boxes.
+             */
+            IncrementalParser( const Parser & parser, const Callback & callback );
+            
+            /*!
+             * @function    IncrementalParser
+             * @abstract    Copy constructor.
+             * @param       o   The object to copy from.
+             */
+            IncrementalParser( const IncrementalParser & o );
+            
+            /*!
+             * @function    IncrementalParser
+             * @abstract    Move constructor.
+             * @param       o   The object to move from.
+             */
+            IncrementalParser( IncrementalParser && o ) noexcept;
+            
+            /*!
+             * @function    ~IncrementalParser
+             * @abstract    Destructor.
+             */
+            virtual ~IncrementalParser();
+            
+            /*!
+             * @function    operator=
+             * @abstract    Assignment operator.
+             * @param       o   The object to assign from.
+             */
+            IncrementalParser & operator =( IncrementalParser o );
+            
+            /*!
+             * @function    Feed
+             * @abstract    Feeds data to the parser.
+             * @param       data    The data bytes, following the previously fed bytes.
+             * @param       size    The number of data bytes.
+             * @discussion  The callback is invoked for every top-level box
+             *              completed by the data, before returning.
+             *              The data is not retained.
+             *              If an exception is thrown, the parser needs to be
+             *              reset before feeding it again.
+             */
+            void Feed( const uint8_t * data, size_t size ) noexcept( false );
+            
+            /*!
+             * @function    Finish
+             * @abstract    Signals the end of the stream.
+             * @discussion  A last top-level box with a size of 0, which
+             *              extends to the end of the stream, is parsed and
+             *              passed to the callback. An exception is thrown if
+             *              a box is incomplete.
+             *              The parser is then reset.
+             */
+            void Finish() noexcept( false );
+            
+            /*!
+             * @function    Reset
+             * @abstract    Discards the box in progress, and starts a new stream.
+             */
+            void Reset();
+            
+            /*!
+             * @function    GetOffset
+             * @abstract    Gets the number of bytes fed since the start of the stream.
+             * @result      The offset in the stream.
+             */
+            uint64_t GetOffset() const;
+            
+            /*!
+             * @function    GetBufferedSize
+             * @abstract    Gets the number of bytes buffered for the box in progress.
+             * @result      The number of buffered bytes.
+             */
+            size_t GetBufferedSize() const;
+            
+            /*!
+             * @function    swap
+             * @abstract    Swap two objects.
+             * @param       o1  The first object to swap.
+             * @param       o2  The second object to swap.
+             */
+            ISOBMFF_EXPORT friend void swap( IncrementalParser & o1, IncrementalParser & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* ISOBMFF_INCREMENTAL_PARSER_HPP */
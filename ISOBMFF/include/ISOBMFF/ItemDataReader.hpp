@@ -0,0 +1,241 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      ItemDataReader.hpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#ifndef ISOBMFF_ITEM_DATA_READER_HPP
+#define ISOBMFF_ITEM_DATA_READER_HPP
+
+#include <memory>
+#include <algorithm>
+#include <ISOBMFF/Macros.hpp>
+#include <ISOBMFF/BinaryStream.hpp>
+#include <ISOBMFF/DataView.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace ISOBMFF
+{
+    class File;
+    class META;
+    
+    /*!
+     * @class       ItemDataReader
+     * @abstract    Reads the data of the items of a meta box.
+     * @discussion  Item locations from the iloc box are resolved into
+     *              lists of byte ranges, either in the file (construction
+     *              method 0), in the idat box (construction method 1), or
+     *              in the data of other items referenced with iloc
+     *              references (construction method 2).
+     *              Contiguous ranges are merged, so each item is read with
+     *              as few reads as possible.
+     *              Items stored in other files are not supported.
+     *              Once created, a reader may be used concurrently from
+     *              several threads, as streams are only read with ReadAt.
+     */
+    class ISOBMFF_EXPORT ItemDataReader
+    {
+        public:
+            
+            /*!
+             * @enum        Source
+             * @abstract    Where the bytes of a range are stored.
+             */
+            enum class Source
+            {
+                File,
+                IDAT
+            };
+            
+            /*!
+             * @class       Range
+             * @abstract    Range of bytes of an item.
+             */
+            class ISOBMFF_EXPORT Range
+            {
+                public:
+                    
+                    Range( Source source, uint64_t offset, uint64_t length );
+                    
+                    /*!
+                     * @function    GetSource
+                     * @abstract    Gets where the bytes are stored.
+                     */
+                    Source GetSource() const;
+                    
+                    /*!
+                     * @function    GetOffset
+                     * @abstract    Gets the offset of the range, from the start of
+                     *              the file or of the idat box data.
+                     */
+                    uint64_t GetOffset() const;
+                    
+                    /*!
+                     * @function    GetLength
+                     * @abstract    Gets the length of the range.
+                     */
+                    uint64_t GetLength() const;
+                    
+                private:
+                    
+                    Source   _source;
+                    uint64_t _offset;
+                    uint64_t _length;
+            };
+            
+            /*!
+             * @function    ItemDataReader
+             * @abstract    Creates a reader without items.
+             */
+            ItemDataReader();
+            
+            /*!
+             * @function    ItemDataReader
+             * @abstract    Creates a reader for the items of a meta box.
+             * @param       meta    The meta box.
+             * @param       stream  The stream the meta box was parsed from,
+             *                      needed for items stored in the file.
+             *                      May be nullptr if all items are stored in
+             *                      the idat box.
+             * @discussion  The item locations are copied, so the meta box
+             *              doesn't need to be retained.
+             */
+            ItemDataReader( const META & meta, const std::shared_ptr< BinaryStream > & stream );
+            
+            /*!
+             * @function    ItemDataReader
+             * @abstract    Creates a reader for the items of a file.
+             * @param       file    The file, with a top-level meta box.
+             * @param       stream  The stream the file was parsed from.
+             * @discussion  Throws an exception if the file has no meta box.
+             */
+            ItemDataReader( const File & file, const std::shared_ptr< BinaryStream > & stream );
+            
+            /*!
+             * @function    ItemDataReader
+             * @abstract    Copy constructor.
+             * @param       o   The object to copy from.
+             */
+            ItemDataReader( const ItemDataReader & o );
+            
+            /*!
+             * @function    ItemDataReader
+             * @abstract    Move constructor.
+             * @param       o   The object to move from.
+             */
+            ItemDataReader( ItemDataReader && o ) noexcept;
+            
+            /*!
+             * @function    ~ItemDataReader
+             * @abstract    Destructor.
+             */
+            virtual ~ItemDataReader();
+            
+            /*!
+             * @function    operator=
+             * @abstract    Assignment operator.
+             * @param       o   The object to assign from.
+             */
+            ItemDataReader & operator =( ItemDataReader o );
+            
+            /*!
+             * @function    HasItem
+             * @abstract    Checks if an item has a location.
+             * @param       itemID  The item ID.
+             * @result      true if the item is listed in the iloc box, otherwise false.
+             */
+            bool HasItem( uint32_t itemID ) const;
+            
+            /*!
+             * @function    GetRanges
+             * @abstract    Gets the byte ranges of an item.
+             * @param       itemID  The item ID.
+             * @result      The ranges, in the order of the item data, with
+             *              contiguous ranges merged.
+             * @discussion  Throws an exception if the item doesn't exist, or
+             *              if its location is invalid or unsupported.
+             */
+            std::vector< Range > GetRanges( uint32_t itemID ) const;
+            
+            /*!
+             * @function    GetSize
+             * @abstract    Gets the size of the data of an item.
+             * @param       itemID  The item ID.
+             * @result      The data size, in bytes.
+             */
+            uint64_t GetSize( uint32_t itemID ) const;
+            
+            /*!
+             * @function    Read
+             * @abstract    Reads the data of an item into a buffer.
+             * @param       itemID  The item ID.
+             * @param       buf     The buffer to read into.
+             * @param       size    The size of the buffer, which must be at
+             *                      least the size of the item data.
+             * @result      The number of bytes read.
+             * @see         GetSize
+             */
+            size_t Read( uint32_t itemID, uint8_t * buf, size_t size ) const;
+            
+            /*!
+             * @function    GetData
+             * @abstract    Reads the data of an item.
+             * @param       itemID  The item ID.
+             * @result      The item data.
+             */
+            std::vector< uint8_t > GetData( uint32_t itemID ) const;
+            
+            /*!
+             * @function    GetDataView
+             * @abstract    Reads the data of an item, as a view.
+             * @param       itemID  The item ID.
+             * @result      A view on the item data.
+             * @discussion  Items stored as a single range are not copied
+             *              when the stream is memory-mapped or in memory,
+             *              nor when they are stored in the idat box.
+             *              Other items are read into a new buffer.
+             */
+            DataView GetDataView( uint32_t itemID ) const;
+            
+            /*!
+             * @function    swap
+             * @abstract    Swap two objects.
+             * @param       o1  The first object to swap.
+             * @param       o2  The second object to swap.
+             */
+            ISOBMFF_EXPORT friend void swap( ItemDataReader & o1, ItemDataReader & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* ISOBMFF_ITEM_DATA_READER_HPP */
@@ -0,0 +1,335 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      ItemIndex.hpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#ifndef ISOBMFF_ITEM_INDEX_HPP
+#define ISOBMFF_ITEM_INDEX_HPP
+
+#include <memory>
+#include <algorithm>
+#include <ISOBMFF/Macros.hpp>
+#include <ISOBMFF/Box.hpp>
+#include <ISOBMFF/FourCC.hpp>
+#include <ISOBMFF/ILOC.hpp>
+#include <ISOBMFF/INFE.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace ISOBMFF
+{
+    class File;
+    class META;
+    
+    /*!
+     * @class       ItemIndex
+     * @abstract    Index of the items of a meta box.
+     * @discussion  Joins the item infos (iinf), locations (iloc), property
+     *              associations (ipma, ipco), references (iref) and the
+     *              primary item (pitm), built once for all items.
+     *              Items are given dense indices, and their properties and
+     *              references are stored in flat arrays, so looking up an
+     *              item doesn't depend on the number of items.
+     *              Once built, an index is never modified, so it can be
+     *              shared between threads.
+     */
+    class ISOBMFF_EXPORT ItemIndex
+    {
+        public:
+            
+            /*!
+             * @constant    NoItem
+             * @abstract    Index returned for unknown item IDs.
+             */
+            static const uint32_t NoItem = UINT32_MAX;
+            
+            /*!
+             * @class       Property
+             * @abstract    Property associated with an item.
+             */
+            class ISOBMFF_EXPORT Property
+            {
+                public:
+                    
+                    Property( uint16_t index, bool essential, std::shared_ptr< Box > box );
+                    
+                    /*!
+                     * @function    GetIndex
+                     * @abstract    Gets the 1-based index of the property in the ipco box.
+                     */
+                    uint16_t GetIndex() const;
+                    
+                    /*!
+                     * @function    IsEssential
+                     * @abstract    Checks if the property is essential to the item.
+                     */
+                    bool IsEssential() const;
+                    
+                    /*!
+                     * @function    GetBox
+                     * @abstract    Gets the property box.
+                     */
+                    std::shared_ptr< Box > GetBox() const;
+                    
+                private:
+                    
+                    uint16_t               _index;
+                    bool                   _essential;
+                    std::shared_ptr< Box > _box;
+            };
+            
+            /*!
+             * @class       Reference
+             * @abstract    Reference between two items.
+             */
+            class ISOBMFF_EXPORT Reference
+            {
+                public:
+                    
+                    Reference( FourCC type, uint32_t itemID );
+                    
+                    /*!
+                     * @function    GetType
+                     * @abstract    Gets the reference type, like thmb or dimg.
+                     */
+                    FourCC GetType() const;
+                    
+                    /*!
+                     * @function    GetItemID
+                     * @abstract    Gets the ID of the other item.
+                     * @discussion  This is the referenced item for references
+                     *              from an item, and the referencing item for
+                     *              references to an item.
+                     */
+                    uint32_t GetItemID() const;
+                    
+                private:
+                    
+                    FourCC   _type;
+                    uint32_t _itemID;
+            };
+            
+            /*!
+             * @function    ItemIndex
+             * @abstract    Creates an empty index.
+             */
+            ItemIndex();
+            
+            /*!
+             * @function    ItemIndex
+             * @abstract    Indexes the items of a meta box.
+             * @param       meta    The meta box.
+             */
+            ItemIndex( const META & meta );
+            
+            /*!
+             * @function    ItemIndex
+             * @abstract    Indexes the items of a file.
+             * @param       file    The file, with a top-level meta box.
+             * @discussion  Throws an exception if the file has no meta box.
+             */
+            ItemIndex( const File & file );
+            
+            /*!
+             * @function    ItemIndex
+             * @abstract    Copy constructor.
+             * @param       o   The object to copy from.
+             */
+            ItemIndex( const ItemIndex & o );
+            
+            /*!
+             * @function    ItemIndex
+             * @abstract    Move constructor.
+             * @param       o   The object to move from.
+             */
+            ItemIndex( ItemIndex && o ) noexcept;
+            
+            /*!
+             * @function    ~ItemIndex
+             * @abstract    Destructor.
+             */
+            virtual ~ItemIndex();
+            
+            /*!
+             * @function    operator=
+             * @abstract    Assignment operator.
+             * @param       o   The object to assign from.
+             */
+            ItemIndex & operator =( ItemIndex o );
+            
+            /*!
+             * @function    GetItemCount
+             * @abstract    Gets the number of items.
+             * @discussion  Items are listed in the iinf box, or referred to
+             *              by any other box of the index.
+             */
+            size_t GetItemCount() const;
+            
+            /*!
+             * @function    GetIndex
+             * @abstract    Gets the dense index of an item.
+             * @param       itemID  The item ID.
+             * @result      The index, from 0 to GetItemCount() - 1, or NoItem
+             *              if the item doesn't exist.
+             */
+            uint32_t GetIndex( uint32_t itemID ) const;
+            
+            /*!
+             * @function    GetItemID
+             * @abstract    Gets the ID of an item from its dense index.
+             * @param       index   The item index.
+             * @result      The item ID.
+             */
+            uint32_t GetItemID( uint32_t index ) const;
+            
+            /*!
+             * @function    GetItemIDs
+             * @abstract    Gets the IDs of all items, in index order.
+             */
+            const std::vector< uint32_t > & GetItemIDs() const;
+            
+            /*!
+             * @function    HasItem
+             * @abstract    Checks if an item exists.
+             * @param       itemID  The item ID.
+             */
+            bool HasItem( uint32_t itemID ) const;
+            
+            /*!
+             * @function    GetPrimaryItemID
+             * @abstract    Gets the ID of the primary item.
+             * @result      The item ID, or 0 if there is no pitm box.
+             */
+            uint32_t GetPrimaryItemID() const;
+            
+            /*!
+             * @function    GetItemInfo
+             * @abstract    Gets the info entry of an item.
+             * @param       itemID  The item ID.
+             * @result      The entry, or nullptr if the item has none.
+             */
+            std::shared_ptr< INFE > GetItemInfo( uint32_t itemID ) const;
+            
+            /*!
+             * @function    GetItemType
+             * @abstract    Gets the type of an item, like hvc1, grid or Exif.
+             * @param       itemID  The item ID.
+             * @result      The type, or an empty string if the item has no info entry.
+             */
+            std::string GetItemType( uint32_t itemID ) const;
+            
+            /*!
+             * @function    GetItemLocation
+             * @abstract    Gets the location of an item.
+             * @param       itemID  The item ID.
+             * @result      The location, or nullptr if the item has none.
+             */
+            std::shared_ptr< ILOC::Item > GetItemLocation( uint32_t itemID ) const;
+            
+            /*!
+             * @function    GetProperties
+             * @abstract    Gets the properties associated with an item.
+             * @param       itemID  The item ID.
+             * @result      The properties, in association order.
+             */
+            std::vector< Property > GetProperties( uint32_t itemID ) const;
+            
+            /*!
+             * @function    GetProperty
+             * @abstract    Gets the first property of an item with a specific type.
+             * @param       itemID  The item ID.
+             * @param       type    The property box type, like ispe or hvcC.
+             * @result      The property box, or nullptr if not found.
+             */
+            std::shared_ptr< Box > GetProperty( uint32_t itemID, FourCC type ) const;
+            
+            /*!
+             * @function    GetTypedProperty
+             * @abstract    Gets the first property of an item with a specific type.
+             * @param       itemID  The item ID.
+             * @param       type    The property box type, like ispe or hvcC.
+             * @result      The property box, or nullptr if not found or if
+             *              the box is not of the correct type.
+             */
+            template< class _T_ >
+            std::shared_ptr< _T_ > GetTypedProperty( uint32_t itemID, FourCC type ) const
+            {
+                return std::dynamic_pointer_cast< _T_ >( this->GetProperty( itemID, type ) );
+            }
+            
+            /*!
+             * @function    GetReferences
+             * @abstract    Gets the references from an item to other items.
+             * @param       itemID  The item ID.
+             * @result      The references, in file order.
+             */
+            std::vector< Reference > GetReferences( uint32_t itemID ) const;
+            
+            /*!
+             * @function    GetReferencedItems
+             * @abstract    Gets the items referenced by an item, with a specific reference type.
+             * @param       itemID  The item ID.
+             * @param       type    The reference type, like dimg for the tiles of a grid.
+             * @result      The referenced item IDs.
+             */
+            std::vector< uint32_t > GetReferencedItems( uint32_t itemID, FourCC type ) const;
+            
+            /*!
+             * @function    GetReferencesTo
+             * @abstract    Gets the references from other items to an item.
+             * @param       itemID  The item ID.
+             * @result      The references, with the IDs of the referencing items.
+             */
+            std::vector< Reference > GetReferencesTo( uint32_t itemID ) const;
+            
+            /*!
+             * @function    GetReferencingItems
+             * @abstract    Gets the items referencing an item, with a specific reference type.
+             * @param       itemID  The item ID.
+             * @param       type    The reference type, like thmb for the thumbnails of an image.
+             * @result      The referencing item IDs.
+             */
+            std::vector< uint32_t > GetReferencingItems( uint32_t itemID, FourCC type ) const;
+            
+            /*!
+             * @function    swap
+             * @abstract    Swap two objects.
+             * @param       o1  The first object to swap.
+             * @param       o2  The second object to swap.
+             */
+            ISOBMFF_EXPORT friend void swap( ItemIndex & o1, ItemIndex & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* ISOBMFF_ITEM_INDEX_HPP */
@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      MDAT.hpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#ifndef ISOBMFF_MDAT_HPP
+#define ISOBMFF_MDAT_HPP
+
+#include <memory>
+#include <algorithm>
+#include <ISOBMFF/Macros.hpp>
+#include <ISOBMFF/Box.hpp>
+
+namespace ISOBMFF
+{
+    /*!
+     * @class       MDAT
+     * @abstract    Media data box.
+     * @discussion  Only the offset and length of the media data are
+     *              recorded while parsing. The data is read on demand from
+     *              the parsed stream, which the box retains.
+     *              When the stream can't be retained, like when parsing a
+     *              caller-owned stream, the data is copied instead.
+     *              If the SkipMDATData option is set, neither the stream
+     *              nor the data is kept, and the data is not available.
+     */
+    class ISOBMFF_EXPORT MDAT: public Box
+    {
+        public:
+            
+            MDAT();
+            MDAT( const MDAT & o );
+            MDAT( MDAT && o ) noexcept;
+            virtual ~MDAT() override;
+            
+            MDAT & operator =( MDAT o );
+            
+            void                                                 ReadData( Parser & parser, BinaryStream & stream ) override;
+            std::vector< std::pair< std::string, std::string > > GetDisplayableProperties() const override;
+            
+            /*!
+             * @function    GetData
+             * @abstract    Gets the whole media data.
+             * @result      The data, or an empty vector if it is not available.
+             * @see         IsDataAvailable
+             */
+            std::vector< uint8_t > GetData() const override;
+            
+            /*!
+             * @function    GetData
+             * @abstract    Gets a range of the media data.
+             * @param       offset  The offset of the range, from the start of the media data.
+             * @param       length  The length of the range.
+             * @result      The data.
+             * @discussion  Throws an exception if the data is not available
+             *              or if the range is out of bounds. Ranges can be
+             *              read concurrently from several threads.
+             */
+            std::vector< uint8_t > GetData( uint64_t offset, uint64_t length ) const;
+            
+            /*!
+             * @function    GetDataView
+             * @abstract    Gets the whole media data, as a view.
+             * @result      The view, which is empty if the data is not available.
+             * @see         IsDataAvailable
+             */
+            DataView GetDataView() const override;
+            
+            /*!
+             * @function    GetDataView
+             * @abstract    Gets a range of the media data, as a view.
+             * @param       offset  The offset of the range, from the start of the media data.
+             * @param       length  The length of the range.
+             * @result      The view.
+             * @discussion  Same as GetData, but the data isn't copied when
+             *              parsed from memory or from a memory-mapped file.
+             */
+            DataView GetDataView( uint64_t offset, uint64_t length ) const;
+            
+            /*!
+             * @function    IsDataAvailable
+             * @abstract    Checks if the media data can be read.
+             * @result      true if the stream was retained or the data copied,
+             *              otherwise false.
+             */
+            bool IsDataAvailable() const;
+            
+            /*!
+             * @function    GetDataOffset
+             * @abstract    Gets the offset of the media data, from the start of the parsed stream.
+             */
+            uint64_t GetDataOffset() const;
+            
+            /*!
+             * @function    GetDataLength
+             * @abstract    Gets the length of the media data.
+             */
+            uint64_t GetDataLength() const;
+            
+            void SetDataOffset( uint64_t value );
+            void SetDataLength( uint64_t value );
+            
+            ISOBMFF_EXPORT friend void swap( MDAT & o1, MDAT & o2 );
+            
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* ISOBMFF_MDAT_HPP */
@@ -39,12 +39,18 @@
 #include <cstdint>
 #include <ISOBMFF/Box.hpp>
 #include <ISOBMFF/File.hpp>
+#include <ISOBMFF/BinarySliceStream.hpp>
+#include <ISOBMFF/Arena.hpp>
+#include <ISOBMFF/BoxVisitor.hpp>
 
 namespace ISOBMFF
 {
     /*!
      * @class       Parser
      * @abstract    ISO media file parser.
+     * @discussion  A parser must not be used by several threads at once,
+     *              but separate parsers, including copies of a parser,
+     *              can be used concurrently.
      */
     class ISOBMFF_EXPORT Parser
     {
@@ -68,13 +74,64 @@ namespace ISOBMFF
             /*!
              * @enum        Options
              * @abstract    Parser options.
-             * @constant    SkipMDATData    Do not keep data found in MDAT boxes.
+             * @constant    SkipMDATData            Do not keep data found in MDAT boxes,
+             *                                      nor the stream to read it on demand.
+             * @constant    UseMemoryMappedFiles    Memory-map files parsed from a path,
+             *                                      instead of reading them through a
+             *                                      file stream.
+             * @constant    LazyParsing             Only record the type, offset and
+             *                                      size of boxes while parsing, and
+             *                                      read their data when they are
+             *                                      first accessed.
+             * @constant    UseArena                Allocate the parsed boxes from an
+             *                                      arena, released when the last box
+             *                                      is destroyed.
+             * @see         Box::Load
+             * @see         CreateObject
              */
             enum class Options: uint64_t
             {
-                SkipMDATData = 1 << 0
+                SkipMDATData         = 1 << 0,
+                UseMemoryMappedFiles = 1 << 1,
+                LazyParsing          = 1 << 2,
+                UseArena             = 1 << 3
             };
             
+            /*!
+             * @typedef     BatchCallback
+             * @abstract    Function receiving the result of each file parsed by ParseMany.
+             * @discussion  The arguments are the index of the file's path,
+             *              the parsed file, or nullptr on failure, and the
+             *              error message, empty on success.
+             * @see         ParseMany
+             */
+            using BatchCallback = std::function< void( size_t, const std::shared_ptr< File > &, const std::string & ) >;
+            
+            /*!
+             * @function    ParseMany
+             * @abstract    Parses many files, in parallel.
+             * @param       paths       The files' paths.
+             * @param       parser      The parser whose box types, options and path filters are used.
+             * @param       threads     The number of threads to use, or 0 to use all cores.
+             * @param       callback    The function receiving the result of each file.
+             * @param       inputOrder  true to receive the results in the order
+             *                          of the paths, false to receive them as
+             *                          soon as each file is parsed.
+             * @discussion  Each thread parses files with its own copy of the
+             *              parser, and takes files from the other threads
+             *              when it runs out of work. A file that cannot be
+             *              parsed does not stop the other files.
+             *              In input order, the threads share a single queue,
+             *              and do not parse files too far ahead of the next
+             *              result to deliver, so the results waiting to be
+             *              delivered stay bounded.
+             *              The callback is never invoked by several threads
+             *              at once. If it throws, the remaining files are
+             *              not parsed, and the exception is rethrown once all
+             *              threads are done.
+             */
+            static void ParseMany( const std::vector< std::string > & paths, const Parser & parser, size_t threads, const BatchCallback & callback, bool inputOrder = false ) noexcept( false );
+            
             /*!
              * @function    Parser
              * @abstract    Default constructor.
@@ -95,6 +152,15 @@ namespace ISOBMFF
              */
             Parser( const std::vector< uint8_t > & data );
             
+            /*!
+             * @function    Parser
+             * @abstract    Creates a parser for caller-owned data.
+             * @param       data    The data bytes.
+             * @param       size    The number of data bytes.
+             * @see         Parse
+             */
+            Parser( const uint8_t * data, size_t size );
+            
             /*!
              * @function    Parser
              * @abstract    Creates a parser for a stream.
@@ -147,6 +213,72 @@ namespace ISOBMFF
              */
             void RegisterContainerBox( const std::string & type );
             
+            /*!
+             * @function    IsContainerBox
+             * @abstract    Checks if a box type is registered as containing other boxes.
+             * @param       type    The box type.
+             * @result      true if the box type contains other boxes, otherwise false.
+             * @see         GetChildBoxesOffset
+             */
+            bool IsContainerBox( FourCC type ) const;
+            
+            /*!
+             * @function    IsContainerBox
+             * @abstract    Checks if a box type is registered as containing other boxes.
+             * @param       type    The box type (four character string).
+             * @result      true if the box type contains other boxes, otherwise false.
+             * @see         GetChildBoxesOffset
+             */
+            bool IsContainerBox( const std::string & type ) const;
+            
+            /*!
+             * @function    GetChildBoxesOffset
+             * @abstract    Gets the offset of the child boxes in the data of a container box.
+             * @param       type    The box type (four character string).
+             * @result      The number of bytes preceding the child boxes, like
+             *              the version and flags of full boxes, or 0.
+             * @discussion  For IINF, this is the offset for version 0, and for
+             *              META, the offset for ISO files rather than QuickTime.
+             * @see         IsContainerBox
+             */
+            uint64_t GetChildBoxesOffset( FourCC type ) const;
+            
+            /*!
+             * @function    GetChildBoxesOffset
+             * @abstract    Gets the offset of the child boxes in the data of a container box.
+             * @param       type    The box type (four character string).
+             * @result      The number of bytes preceding the child boxes, or 0.
+             * @see         IsContainerBox
+             */
+            uint64_t GetChildBoxesOffset( const std::string & type ) const;
+            
+            /*!
+             * @function    IsRegisteredBox
+             * @abstract    Checks if a box type is registered.
+             * @param       type    The box type.
+             * @result      true if a box class is registered for the type,
+             *              otherwise false, in which case CreateBox returns
+             *              a generic box.
+             */
+            bool IsRegisteredBox( FourCC type ) const;
+            
+            /*!
+             * @function    IsRegisteredBox
+             * @abstract    Checks if a box type is registered.
+             * @param       type    The box type (four character string).
+             * @result      true if a box class is registered for the type,
+             *              otherwise false.
+             */
+            bool IsRegisteredBox( const std::string & type ) const;
+            
+            /*!
+             * @function    CreateBox
+             * @abstract    Creates a new box for a specific type.
+             * @param       type    The box type.
+             * @result      A new box.
+             */
+            std::shared_ptr< Box > CreateBox( FourCC type ) const;
+            
             /*!
              * @function    CreateBox
              * @abstract    Creates a new box for a specific type.
@@ -155,11 +287,72 @@ namespace ISOBMFF
              */
             std::shared_ptr< Box > CreateBox( const std::string & type ) const;
             
+            /*!
+             * @function    GetStream
+             * @abstract    Gets the stream being parsed, if it can be retained.
+             * @result      The stream, or nullptr if no file is being parsed,
+             *              or if the stream is owned by the caller and the
+             *              LazyParsing option is not set.
+             * @discussion  Boxes can retain the stream to read their data
+             *              on demand.
+             * @see         GetStreamOffset
+             */
+            std::shared_ptr< BinaryStream > GetStream() const;
+            
+            /*!
+             * @function    GetStreamOffset
+             * @abstract    Gets the offset of a slice of the stream being parsed.
+             * @param       stream  A slice of the stream being parsed, like the
+             *                      data of a box.
+             * @result      The offset of the slice, from the start of the
+             *              parsed stream.
+             * @see         GetStream
+             */
+            uint64_t GetStreamOffset( const BinarySliceStream & stream ) const;
+            
+            /*!
+             * @function    GetArena
+             * @abstract    Gets the arena used for the file being parsed.
+             * @result      The arena, or nullptr if the UseArena option is not
+             *              set or if no file is being parsed.
+             * @see         CreateObject
+             */
+            std::shared_ptr< Arena > GetArena() const;
+            
+            /*!
+             * @function    CreateObject
+             * @abstract    Creates an object for the file being parsed.
+             * @param       args    The object's constructor arguments.
+             * @result      The new object.
+             * @discussion  If the UseArena option is set, the object is
+             *              allocated from the arena of the file being parsed.
+             *              Boxes should use this method for the objects they
+             *              create while reading data.
+             */
+            template< class _T_, typename ... _A_ >
+            std::shared_ptr< _T_ > CreateObject( _A_ && ... args ) const
+            {
+                std::shared_ptr< Arena > arena( this->GetArena() );
+                
+                if( arena == nullptr )
+                {
+                    return std::make_shared< _T_ >( std::forward< _A_ >( args ) ... );
+                }
+                
+                return std::allocate_shared< _T_ >( ArenaAllocator< _T_ >( std::move( arena ) ), std::forward< _A_ >( args ) ... );
+            }
+            
             /*!
              * @function    Parse
              * @abstract    Parses a file.
              * @discussion  This will discard any previously parsed file.
+             *              If the UseMemoryMappedFiles option is set, the file
+             *              will be memory-mapped rather than read through a
+             *              file stream.
+             *              MDAT boxes retain the file stream, to read their
+             *              data on demand.
              * @param       path    The file's path.
+             * @see         Options
              */
             void Parse( const std::string & path ) noexcept( false );
             
@@ -167,18 +360,74 @@ namespace ISOBMFF
              * @function    Parse
              * @abstract    Parses data.
              * @discussion  This will discard any previously parsed file/data.
+             *              If the LazyParsing option is set, the data needs to
+             *              remain valid until all boxes are loaded.
              * @param       data    The data bytes.
              */
             void Parse( const std::vector< uint8_t > & data ) noexcept( false );
             
+            /*!
+             * @function    Parse
+             * @abstract    Parses caller-owned data, in place.
+             * @discussion  This will discard any previously parsed file/data.
+             *              The data is not copied, and only needs to remain
+             *              valid while parsing, or until all boxes are loaded
+             *              and while MDAT data is read if the LazyParsing
+             *              option is set.
+             * @param       data    The data bytes.
+             * @param       size    The number of data bytes.
+             */
+            void Parse( const uint8_t * data, size_t size ) noexcept( false );
+            
             /*!
              * @function    Parse
              * @abstract    Parses data from a stream.
              * @discussion  This will discard any previously parsed file/data.
+             *              If the LazyParsing option is set, the stream needs
+             *              to remain valid until all boxes are loaded, and
+             *              while MDAT data is read.
              * @param       stream  The stream object.
              */
             void Parse( BinaryStream & stream ) noexcept( false );
             
+            /*!
+             * @function    Parse
+             * @abstract    Parses data from a shared stream.
+             * @discussion  This will discard any previously parsed file/data.
+             *              The stream is retained by MDAT boxes, and by the
+             *              boxes that are not loaded yet if the LazyParsing
+             *              option is set.
+             * @param       stream  The stream object.
+             */
+            void Parse( const std::shared_ptr< BinaryStream > & stream ) noexcept( false );
+            
+            /*!
+             * @function    Visit
+             * @abstract    Visits a file, without building a box tree.
+             * @param       path        The file's path.
+             * @param       visitor     The visitor receiving the boxes.
+             * @see         Visit
+             */
+            void Visit( const std::string & path, BoxVisitor & visitor ) noexcept( false );
+            
+            /*!
+             * @function    Visit
+             * @abstract    Visits data from a stream, without building a box tree.
+             * @param       stream      The stream object.
+             * @param       visitor     The visitor receiving the boxes.
+             * @discussion  The visitor's callbacks are invoked while parsing,
+             *              and each box is released once visited. Container
+             *              boxes are not given their child boxes, and no file
+             *              object is created. The data of boxes with no
+             *              registered class is not read, and MDAT boxes only
+             *              record the range of their data.
+             *              The parser's options and path filters apply, but
+             *              boxes are always read immediately, and the parser
+             *              itself is not modified.
+             * @see         BoxVisitor
+             */
+            void Visit( BinaryStream & stream, BoxVisitor & visitor ) noexcept( false );
+            
             /*!
              * @function    GetFile
              * @abstract    Upon successful parsing, gets the file object.
@@ -243,6 +492,37 @@ namespace ISOBMFF
              */
             bool HasOption( Options option );
             
+            /*!
+             * @function    GetPathFilters
+             * @abstract    Gets the box paths selected for parsing.
+             * @result      The selected box paths.
+             * @see         SetPathFilters
+             */
+            std::vector< std::string > GetPathFilters() const;
+            
+            /*!
+             * @function    SetPathFilters
+             * @abstract    Sets the box paths selected for parsing.
+             * @param       paths   The selected box paths, like "moov/trak/tkhd".
+             * @discussion  When paths are set, the parser only reads the boxes
+             *              leading to a selected path, and all the boxes
+             *              contained in it. Other boxes are skipped and not
+             *              added to the parsed file, except the top-level FTYP
+             *              box, which is always read. Skipped IPCO properties
+             *              are kept as unread boxes, so the other properties
+             *              keep their index.
+             *              An empty list selects all boxes.
+             */
+            void SetPathFilters( const std::vector< std::string > & paths );
+            
+            /*!
+             * @function    AddPathFilter
+             * @abstract    Adds a box path to the paths selected for parsing.
+             * @param       path    The box path, like "meta/iprp/ipco/ispe".
+             * @see         SetPathFilters
+             */
+            void AddPathFilter( const std::string & path );
+            
             /*!
              * @function    GetInfo
              * @abstract    Gets an info value in the parser.
@@ -274,6 +554,8 @@ namespace ISOBMFF
             
         private:
             
+            friend class ParserInternal;
+            
             class IMPL;
             
             std::unique_ptr< IMPL > impl;
@@ -77,6 +77,7 @@ namespace ISOBMFF
 
                 ReferenceObject();
                 ReferenceObject(BinaryStream& stream);
+                ReferenceObject(BinaryDataReader& stream);
                 ReferenceObject(const ReferenceObject& o);
                 ReferenceObject(ReferenceObject&& o) noexcept;
                 virtual ~ReferenceObject() override;
@@ -105,6 +106,9 @@ namespace ISOBMFF
 
             private:
 
+                template< typename T >
+                void Read(T& stream);
+
                 class IMPL;
 
                 std::unique_ptr< IMPL > impl;
@@ -0,0 +1,200 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @header      ThumbnailReader.hpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#ifndef ISOBMFF_THUMBNAIL_READER_HPP
+#define ISOBMFF_THUMBNAIL_READER_HPP
+
+#include <memory>
+#include <algorithm>
+#include <ISOBMFF/Macros.hpp>
+#include <ISOBMFF/BinaryStream.hpp>
+#include <ISOBMFF/HVCC.hpp>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+namespace ISOBMFF
+{
+    /*!
+     * @class       ThumbnailReader
+     * @abstract    Reads the thumbnail of the primary item of a HEIF file.
+     * @discussion  Only the top-level box headers, and the ftyp and meta
+     *              boxes, are read from the file. Other boxes, like mdat,
+     *              are skipped without reading their data.
+     *              The thumbnail is found by following the thmb references
+     *              to the primary item (pitm), and its data is read from
+     *              its iloc extents only when requested.
+     *              Reads use ReadAt, so the stream's read-ahead buffer,
+     *              if any, is not filled with unneeded data.
+     */
+    class ISOBMFF_EXPORT ThumbnailReader
+    {
+        public:
+            
+            /*!
+             * @function    ThumbnailReader
+             * @abstract    Creates a reader without a thumbnail.
+             */
+            ThumbnailReader();
+            
+            /*!
+             * @function    ThumbnailReader
+             * @abstract    Finds the thumbnail of a file.
+             * @param       path    The file's path.
+             * @discussion  Throws an exception if the file has no ftyp or
+             *              meta box.
+             */
+            ThumbnailReader( const std::string & path );
+            
+            /*!
+             * @function    ThumbnailReader
+             * @abstract    Finds the thumbnail of a file, from a stream.
+             * @param       stream  The stream, which is retained to read
+             *                      the thumbnail data.
+             * @discussion  Throws an exception if the file has no ftyp or
+             *              meta box.
+             */
+            ThumbnailReader( const std::shared_ptr< BinaryStream > & stream );
+            
+            /*!
+             * @function    ThumbnailReader
+             * @abstract    Copy constructor.
+             * @param       o   The object to copy from.
+             */
+            ThumbnailReader( const ThumbnailReader & o );
+            
+            /*!
+             * @function    ThumbnailReader
+             * @abstract    Move constructor.
+             * @param       o   The object to move from.
+             */
+            ThumbnailReader( ThumbnailReader && o ) noexcept;
+            
+            /*!
+             * @function    ~ThumbnailReader
+             * @abstract    Destructor.
+             */
+            virtual ~ThumbnailReader();
+            
+            /*!
+             * @function    operator=
+             * @abstract    Assignment operator.
+             * @param       o   The object to assign from.
+             */
+            ThumbnailReader & operator =( ThumbnailReader o );
+            
+            /*!
+             * @function    HasThumbnail
+             * @abstract    Checks if the primary item has a thumbnail.
+             */
+            bool HasThumbnail() const;
+            
+            /*!
+             * @function    GetPrimaryItemID
+             * @abstract    Gets the ID of the primary item.
+             * @result      The item ID, or 0 if there is no pitm box.
+             */
+            uint32_t GetPrimaryItemID() const;
+            
+            /*!
+             * @function    GetItemID
+             * @abstract    Gets the ID of the thumbnail item.
+             * @result      The item ID, or 0 if there is no thumbnail.
+             * @discussion  When the primary item has several thumbnails,
+             *              the first one in the iref box is used.
+             */
+            uint32_t GetItemID() const;
+            
+            /*!
+             * @function    GetItemType
+             * @abstract    Gets the type of the thumbnail item, like hvc1.
+             * @result      The item type, or an empty string if there is no thumbnail.
+             */
+            std::string GetItemType() const;
+            
+            /*!
+             * @function    GetWidth
+             * @abstract    Gets the width of the thumbnail, from its ispe property.
+             * @result      The width, or 0 if unknown.
+             */
+            uint32_t GetWidth() const;
+            
+            /*!
+             * @function    GetHeight
+             * @abstract    Gets the height of the thumbnail, from its ispe property.
+             * @result      The height, or 0 if unknown.
+             */
+            uint32_t GetHeight() const;
+            
+            /*!
+             * @function    GetHVCC
+             * @abstract    Gets the HEVC decoder configuration of the thumbnail.
+             * @result      The hvcC property, or nullptr if the thumbnail has none.
+             */
+            std::shared_ptr< HVCC > GetHVCC() const;
+            
+            /*!
+             * @function    GetData
+             * @abstract    Reads the thumbnail item data, as stored in the file.
+             * @result      The data, or an empty vector if there is no thumbnail.
+             * @discussion  For HEVC thumbnails, NAL units are prefixed with
+             *              their length, as described by the hvcC property.
+             */
+            std::vector< uint8_t > GetData() const;
+            
+            /*!
+             * @function    GetBitstream
+             * @abstract    Reads the thumbnail as a bitstream that can be
+             *              passed to a decoder.
+             * @result      The bitstream, or an empty vector if there is no thumbnail.
+             * @discussion  For HEVC thumbnails, this is an Annex B byte
+             *              stream, starting with the parameter sets of the
+             *              hvcC property. Other thumbnails are returned as
+             *              stored in the file.
+             */
+            std::vector< uint8_t > GetBitstream() const;
+            
+            /*!
+             * @function    swap
+             * @abstract    Swap two objects.
+             * @param       o1  The first object to swap.
+             * @param       o2  The second object to swap.
+             */
+            ISOBMFF_EXPORT friend void swap( ThumbnailReader & o1, ThumbnailReader & o2 );
+        
+        private:
+            
+            class IMPL;
+            
+            std::unique_ptr< IMPL > impl;
+    };
+}
+
+#endif /* ISOBMFF_THUMBNAIL_READER_HPP */
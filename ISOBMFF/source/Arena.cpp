@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @file        Arena.cpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#include <ISOBMFF/Arena.hpp>
+#include <vector>
+#include <stdexcept>
+
+namespace ISOBMFF
+{
+    class Arena::IMPL
+    {
+        public:
+            
+            IMPL( size_t chunkSize );
+            ~IMPL();
+            
+            size_t                                   _chunkSize;
+            std::vector< std::unique_ptr< char[] > > _chunks;
+            char                                   * _current;
+            size_t                                   _available;
+            uint64_t                                 _allocated;
+    };
+    
+    Arena::Arena( size_t chunkSize ):
+        impl( std::make_unique< IMPL >( chunkSize ) )
+    {}
+    
+    Arena::~Arena()
+    {}
+    
+    void * Arena::Allocate( size_t size, size_t alignment )
+    {
+        size_t padding;
+        size_t chunkSize;
+        char * p;
+        
+        if( alignment == 0 || ( alignment & ( alignment - 1 ) ) != 0 || alignment > alignof( std::max_align_t ) )
+        {
+            throw std::runtime_error( "Invalid arena alignment" );
+        }
+        
+        padding = static_cast< size_t >( -reinterpret_cast< uintptr_t >( this->impl->_current ) ) & ( alignment - 1 );
+        
+        if( this->impl->_current == nullptr || size > this->impl->_available || padding > this->impl->_available - size )
+        {
+            /* Chunks are allocated with new, so they have the maximum alignment */
+            chunkSize = std::max( this->impl->_chunkSize, size );
+            
+            this->impl->_chunks.emplace_back( new char[ chunkSize ] );
+            
+            this->impl->_current   = this->impl->_chunks.back().get();
+            this->impl->_available = chunkSize;
+            padding                = 0;
+        }
+        
+        p = this->impl->_current + padding;
+        
+        this->impl->_current    = p + size;
+        this->impl->_available -= padding + size;
+        this->impl->_allocated += size;
+        
+        return p;
+    }
+    
+    uint64_t Arena::GetAllocatedBytes() const
+    {
+        return this->impl->_allocated;
+    }
+    
+    size_t Arena::GetChunkCount() const
+    {
+        return this->impl->_chunks.size();
+    }
+    
+    Arena::IMPL::IMPL( size_t chunkSize ):
+        _chunkSize( std::max< size_t >( chunkSize, 1 ) ),
+        _current( nullptr ),
+        _available( 0 ),
+        _allocated( 0 )
+    {}
+    
+    Arena::IMPL::~IMPL()
+    {}
+}
@@ -30,6 +30,7 @@
 
 #include <fstream>
 #include <cmath>
+#include <cstring>
 #include <vector>
 #include <ISOBMFF/BinaryDataStream.hpp>
 #include <ISOBMFF/Casts.hpp>
@@ -42,11 +43,15 @@ namespace ISOBMFF
             
             IMPL();
             IMPL( const std::vector< uint8_t > & data );
+            IMPL( const uint8_t * data, size_t size );
             IMPL( const IMPL & o );
             ~IMPL();
             
-            std::vector< uint8_t > _data;
-            size_t                 _pos;
+            std::shared_ptr< const std::vector< uint8_t > > _data;
+            const uint8_t                                 * _bytes;
+            size_t                                          _size;
+            size_t                                          _pos;
+            bool                                            _ownsData;
     };
     
     BinaryDataStream::BinaryDataStream():
@@ -57,6 +62,10 @@ namespace ISOBMFF
         impl( std::make_unique< IMPL >( data ) )
     {}
     
+    BinaryDataStream::BinaryDataStream( const uint8_t * data, size_t size ):
+        impl( std::make_unique< IMPL >( data, size ) )
+    {}
+    
     BinaryDataStream::BinaryDataStream( const BinaryDataStream & o ):
         impl( std::make_unique< IMPL >( *( o.impl ) ) )
     {}
@@ -77,12 +86,15 @@ namespace ISOBMFF
     
     void BinaryDataStream::Read( uint8_t * buf, size_t size )
     {
-        if( size > this->impl->_data.size() - this->impl->_pos )
+        if( size > this->impl->_size - this->impl->_pos )
         {
             throw std::runtime_error( "Invalid read - Not enough data available" );
         }
         
-        memcpy( buf, &( this->impl->_data[ 0 ] ) + this->impl->_pos, size );
+        if( size > 0 )
+        {
+            memcpy( buf, this->impl->_bytes + this->impl->_pos, size );
+        }
         
         this->impl->_pos += size;
     }
@@ -107,7 +119,7 @@ namespace ISOBMFF
                 throw std::runtime_error( "Invalid seek offset" );
             }
             
-            pos = this->impl->_data.size() - numeric_cast< size_t >( abs( offset ) );
+            pos = this->impl->_size - numeric_cast< size_t >( abs( offset ) );
         }
         else if( offset < 0 )
         {
@@ -118,7 +130,7 @@ namespace ISOBMFF
             pos = this->impl->_pos + numeric_cast< size_t >( offset );
         }
         
-        if( pos > this->impl->_data.size() )
+        if( pos > this->impl->_size )
         {
             throw std::runtime_error( "Invalid seek offset" );
         }
@@ -131,6 +143,72 @@ namespace ISOBMFF
         return this->impl->_pos;
     }
     
+    size_t BinaryDataStream::Size() const
+    {
+        return this->impl->_size;
+    }
+    
+    void BinaryDataStream::ReadAt( uint64_t offset, uint8_t * buf, size_t size ) const
+    {
+        if( offset > this->impl->_size || size > this->impl->_size - offset )
+        {
+            throw std::runtime_error( "Invalid read - Not enough data available" );
+        }
+        
+        if( size > 0 )
+        {
+            memcpy( buf, this->impl->_bytes + offset, size );
+        }
+    }
+    
+    DataView BinaryDataStream::ReadViewAt( uint64_t offset, size_t size ) const
+    {
+        if( this->impl->_ownsData == false )
+        {
+            return BinaryStream::ReadViewAt( offset, size );
+        }
+        
+        if( offset > this->impl->_size || size > this->impl->_size - offset )
+        {
+            throw std::runtime_error( "Invalid read - Not enough data available" );
+        }
+        
+        return DataView( this->impl->_data, this->impl->_bytes + offset, size );
+    }
+    
+    void BinaryDataStream::Get( uint8_t * buf, uint64_t pos, size_t length )
+    {
+        if( pos > this->impl->_size - this->impl->_pos || length > this->impl->_size - this->impl->_pos - pos )
+        {
+            throw std::runtime_error( "Invalid read - Not enough data available" );
+        }
+        
+        if( length > 0 )
+        {
+            memcpy( buf, this->impl->_bytes + this->impl->_pos + pos, length );
+        }
+    }
+    
+    const uint8_t * BinaryDataStream::GetContiguousBytes( size_t size )
+    {
+        if( size > this->impl->_size - this->impl->_pos )
+        {
+            return nullptr;
+        }
+        
+        return this->impl->_bytes + this->impl->_pos;
+    }
+    
+    DataView BinaryDataStream::ReadView( size_t size )
+    {
+        DataView view;
+        
+        view              = this->ReadViewAt( this->impl->_pos, size );
+        this->impl->_pos += size;
+        
+        return view;
+    }
+    
     void swap( BinaryDataStream & o1, BinaryDataStream & o2 )
     {
         using std::swap;
@@ -139,17 +217,38 @@ namespace ISOBMFF
     }
     
     BinaryDataStream::IMPL::IMPL():
-        _pos( 0 )
+        _bytes(    nullptr ),
+        _size(     0 ),
+        _pos(      0 ),
+        _ownsData( true )
     {}
     
     BinaryDataStream::IMPL::IMPL( const std::vector< uint8_t > & data ):
-        _data( data ),
-        _pos(  0 )
+        _data(     std::make_shared< const std::vector< uint8_t > >( data ) ),
+        _bytes(    this->_data->data() ),
+        _size(     this->_data->size() ),
+        _pos(      0 ),
+        _ownsData( true )
     {}
     
+    BinaryDataStream::IMPL::IMPL( const uint8_t * data, size_t size ):
+        _bytes(    data ),
+        _size(     size ),
+        _pos(      0 ),
+        _ownsData( false )
+    {
+        if( data == nullptr && size > 0 )
+        {
+            throw std::runtime_error( "Invalid data" );
+        }
+    }
+    
     BinaryDataStream::IMPL::IMPL( const IMPL & o ):
-        _data( o._data ),
-        _pos(  o._pos )
+        _data(     o._data ),
+        _bytes(    o._bytes ),
+        _size(     o._size ),
+        _pos(      o._pos ),
+        _ownsData( o._ownsData )
     {}
     
     BinaryDataStream::IMPL::~IMPL()
@@ -0,0 +1,369 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        BinaryFetchStream.cpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#include <cmath>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include <ISOBMFF/BinaryFetchStream.hpp>
+#include <ISOBMFF/Casts.hpp>
+
+namespace ISOBMFF
+{
+    class BinaryFetchStream::IMPL
+    {
+        public:
+            
+            IMPL( uint64_t size, FetchFunction fetch, size_t blockSize, size_t blockCount );
+            ~IMPL();
+            
+            class Block
+            {
+                public:
+                    
+                    uint64_t               _index;
+                    std::vector< uint8_t > _data;
+            };
+            
+            void            ReadRange( uint64_t offset, uint8_t * buf, size_t size );
+            void            Load( uint64_t first, uint64_t last, bool sequential );
+            void            Fetch( uint64_t first, uint64_t last );
+            void            Insert( uint64_t index, std::vector< uint8_t > data );
+            const Block   * Touch( uint64_t index );
+            
+            FetchFunction                                                   _fetch;
+            size_t                                                          _size;
+            size_t                                                          _pos;
+            size_t                                                          _blockSize;
+            size_t                                                          _blockCount;
+            uint64_t                                                        _lastEnd;
+            std::list< Block >                                              _blocks;
+            std::unordered_map< uint64_t, std::list< Block >::iterator >    _index;
+            std::mutex                                                      _mutex;
+    };
+    
+    BinaryFetchStream::BinaryFetchStream( uint64_t size, FetchFunction fetch, size_t blockSize, size_t blockCount ):
+        impl( std::make_unique< IMPL >( size, fetch, blockSize, blockCount ) )
+    {}
+    
+    BinaryFetchStream::~BinaryFetchStream()
+    {}
+    
+    void BinaryFetchStream::Read( uint8_t * buf, size_t size )
+    {
+        if( size > this->impl->_size - this->impl->_pos )
+        {
+            throw std::runtime_error( "Invalid read - Not enough data available" );
+        }
+        
+        {
+            std::lock_guard< std::mutex > lock( this->impl->_mutex );
+            
+            this->impl->ReadRange( this->impl->_pos, buf, size );
+        }
+        
+        this->impl->_pos += size;
+    }
+    
+    void BinaryFetchStream::Seek( std::streamoff offset, SeekDirection dir )
+    {
+        size_t pos;
+        
+        if( dir == SeekDirection::Begin )
+        {
+            if( offset < 0 )
+            {
+                throw std::runtime_error( "Invalid seek offset" );
+            }
+            
+            pos = numeric_cast< size_t >( offset );
+        }
+        else if( dir == SeekDirection::End )
+        {
+            if( offset > 0 || numeric_cast< size_t >( std::abs( offset ) ) > this->impl->_size )
+            {
+                throw std::runtime_error( "Invalid seek offset" );
+            }
+            
+            pos = this->impl->_size - numeric_cast< size_t >( std::abs( offset ) );
+        }
+        else if( offset < 0 )
+        {
+            if( numeric_cast< size_t >( std::abs( offset ) ) > this->impl->_pos )
+            {
+                throw std::runtime_error( "Invalid seek offset" );
+            }
+            
+            pos = this->impl->_pos - numeric_cast< size_t >( std::abs( offset ) );
+        }
+        else
+        {
+            pos = this->impl->_pos + numeric_cast< size_t >( offset );
+        }
+        
+        if( pos > this->impl->_size )
+        {
+            throw std::runtime_error( "Invalid seek offset" );
+        }
+        
+        this->impl->_pos = pos;
+    }
+    
+    size_t BinaryFetchStream::Tell() const
+    {
+        return this->impl->_pos;
+    }
+    
+    size_t BinaryFetchStream::Size() const
+    {
+        return this->impl->_size;
+    }
+    
+    void BinaryFetchStream::ReadAt( uint64_t offset, uint8_t * buf, size_t size ) const
+    {
+        std::lock_guard< std::mutex > lock( this->impl->_mutex );
+        
+        if( offset > this->impl->_size || size > this->impl->_size - offset )
+        {
+            throw std::runtime_error( "Invalid read - Not enough data available" );
+        }
+        
+        this->impl->ReadRange( offset, buf, size );
+    }
+    
+    const uint8_t * BinaryFetchStream::GetContiguousBytes( size_t size )
+    {
+        std::lock_guard< std::mutex > lock( this->impl->_mutex );
+        
+        uint64_t index;
+        
+        if( size == 0 || size > this->impl->_size - this->impl->_pos )
+        {
+            return nullptr;
+        }
+        
+        index = this->impl->_pos / this->impl->_blockSize;
+        
+        /*
+         * Only data within a single block can be exposed.
+         */
+        if( ( this->impl->_pos + size - 1 ) / this->impl->_blockSize != index )
+        {
+            return nullptr;
+        }
+        
+        this->impl->Load( index, index, this->impl->_pos == this->impl->_lastEnd );
+        
+        return this->impl->Touch( index )->_data.data() + ( this->impl->_pos - index * this->impl->_blockSize );
+    }
+    
+    size_t BinaryFetchStream::GetBlockSize() const
+    {
+        return this->impl->_blockSize;
+    }
+    
+    size_t BinaryFetchStream::GetBlockCount() const
+    {
+        return this->impl->_blockCount;
+    }
+    
+    BinaryFetchStream::IMPL::IMPL( uint64_t size, FetchFunction fetch, size_t blockSize, size_t blockCount ):
+        _fetch( fetch ),
+        _size( numeric_cast< size_t >( size ) ),
+        _pos( 0 ),
+        _blockSize( std::max< size_t >( blockSize, 1 ) ),
+        _blockCount( std::max< size_t >( blockCount, 2 ) ),
+        _lastEnd( 0 )
+    {
+        if( this->_fetch == nullptr )
+        {
+            throw std::runtime_error( "Invalid fetch function" );
+        }
+    }
+    
+    BinaryFetchStream::IMPL::~IMPL()
+    {}
+    
+    void BinaryFetchStream::IMPL::ReadRange( uint64_t offset, uint8_t * buf, size_t size )
+    {
+        uint64_t first;
+        uint64_t last;
+        uint64_t i;
+        bool     sequential;
+        
+        if( size == 0 )
+        {
+            return;
+        }
+        
+        first          = offset / this->_blockSize;
+        last           = ( offset + size - 1 ) / this->_blockSize;
+        sequential     = offset == this->_lastEnd;
+        this->_lastEnd = offset + size;
+        
+        /*
+         * Reads the cache can't hold, plus a prefetched block, are fetched
+         * directly.
+         */
+        if( last - first + 1 >= this->_blockCount )
+        {
+            this->_fetch( offset, buf, size );
+            
+            return;
+        }
+        
+        this->Load( first, last, sequential );
+        
+        for( i = first; i <= last; i++ )
+        {
+            const Block * block;
+            size_t        start;
+            size_t        n;
+            
+            block = this->Touch( i );
+            start = ( i == first ) ? numeric_cast< size_t >( offset - i * this->_blockSize ) : 0;
+            n     = std::min( block->_data.size() - start, size );
+            
+            memcpy( buf, block->_data.data() + start, n );
+            
+            buf  += n;
+            size -= n;
+        }
+    }
+    
+    void BinaryFetchStream::IMPL::Load( uint64_t first, uint64_t last, bool sequential )
+    {
+        uint64_t count;
+        uint64_t i;
+        uint64_t j;
+        
+        count = ( this->_size + this->_blockSize - 1 ) / this->_blockSize;
+        
+        /*
+         * Marks the cached blocks as recently used first, so they won't be
+         * evicted by the fetches below.
+         */
+        for( i = first; i <= last; i++ )
+        {
+            this->Touch( i );
+        }
+        
+        for( i = first; i <= last; i = j + 1 )
+        {
+            j = i;
+            
+            if( this->_index.find( i ) != this->_index.end() )
+            {
+                continue;
+            }
+            
+            /*
+             * Missing adjacent blocks are fetched at once.
+             */
+            while( j < last && this->_index.find( j + 1 ) == this->_index.end() )
+            {
+                j++;
+            }
+            
+            /*
+             * Sequential reads will most likely need the next block, so
+             * fetch it along.
+             */
+            if( j == last && sequential && j + 1 < count && this->_index.find( j + 1 ) == this->_index.end() )
+            {
+                j++;
+            }
+            
+            this->Fetch( i, j );
+        }
+    }
+    
+    void BinaryFetchStream::IMPL::Fetch( uint64_t first, uint64_t last )
+    {
+        uint64_t               offset;
+        size_t                 length;
+        size_t                 start;
+        size_t                 n;
+        std::vector< uint8_t > data;
+        
+        offset = first * this->_blockSize;
+        length = numeric_cast< size_t >( std::min< uint64_t >( ( last + 1 ) * this->_blockSize, this->_size ) - offset );
+        
+        data.resize( length );
+        
+        this->_fetch( offset, data.data(), length );
+        
+        if( first == last )
+        {
+            this->Insert( first, std::move( data ) );
+            
+            return;
+        }
+        
+        for( uint64_t i = first; i <= last; i++ )
+        {
+            start = numeric_cast< size_t >( ( i - first ) * this->_blockSize );
+            n     = std::min( this->_blockSize, length - start );
+            
+            this->Insert( i, std::vector< uint8_t >( data.begin() + static_cast< std::ptrdiff_t >( start ), data.begin() + static_cast< std::ptrdiff_t >( start + n ) ) );
+        }
+    }
+    
+    void BinaryFetchStream::IMPL::Insert( uint64_t index, std::vector< uint8_t > data )
+    {
+        while( this->_blocks.size() >= this->_blockCount )
+        {
+            this->_index.erase( this->_blocks.back()._index );
+            this->_blocks.pop_back();
+        }
+        
+        this->_blocks.push_front( Block() );
+        
+        this->_blocks.front()._index = index;
+        this->_blocks.front()._data  = std::move( data );
+        this->_index[ index ]        = this->_blocks.begin();
+    }
+    
+    const BinaryFetchStream::IMPL::Block * BinaryFetchStream::IMPL::Touch( uint64_t index )
+    {
+        auto it( this->_index.find( index ) );
+        
+        if( it == this->_index.end() )
+        {
+            return nullptr;
+        }
+        
+        this->_blocks.splice( this->_blocks.begin(), this->_blocks, it->second );
+        
+        return &( *( it->second ) );
+    }
+}
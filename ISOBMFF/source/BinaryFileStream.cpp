@@ -28,14 +28,23 @@
  * @author      Jean-David Gadina - www.digidna.net
  */
 
-#include <fstream>
 #include <cmath>
+#include <cerrno>
+#include <cstring>
 #include <vector>
 #include <ISOBMFF/BinaryFileStream.hpp>
 #include <ISOBMFF/Casts.hpp>
 
 #ifdef _WIN32
 #include <ISOBMFF/WIN32.hpp>
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#else
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 #endif
 
 namespace ISOBMFF
@@ -44,25 +53,80 @@ namespace ISOBMFF
     {
         public:
             
-            IMPL( const std::string & path );
+            /*
+             * Open file handle, shared by copies of a stream.
+             * Reads are positional, so the handle has no meaningful position
+             * and may be used from several threads at once.
+             */
+            class File
+            {
+                public:
+                    
+                    File( const std::string & path );
+                    ~File();
+                    
+                    File( const File & o )              = delete;
+                    File & operator =( const File & o ) = delete;
+                    
+                    void Read( uint64_t offset, uint8_t * buf, size_t size ) const;
+                    
+                    size_t _size;
+                    bool   _isOpen;
+                    
+                    #ifdef _WIN32
+                    HANDLE _handle;
+                    #else
+                    int    _fd;
+                    #endif
+            };
+            
+            IMPL( const std::string & path, size_t bufferSize );
+            IMPL( const IMPL & o );
             ~IMPL();
             
-            std::ifstream _stream;
-            std::string   _path;
-            size_t        _size;
-            size_t        _pos;
+            void Fill( size_t pos );
+            bool IsBuffered( size_t pos, size_t size ) const;
+            
+            std::shared_ptr< File > _file;
+            std::string             _path;
+            size_t                  _size;
+            size_t                  _pos;
+            std::vector< uint8_t >  _buffer;
+            size_t                  _bufferPos;
+            size_t                  _bufferLength;
     };
     
     BinaryFileStream::BinaryFileStream( const std::string & path ):
-        impl( std::make_unique< IMPL >( path ) )
+        BinaryFileStream( path, DefaultBufferSize )
+    {}
+    
+    BinaryFileStream::BinaryFileStream( const std::string & path, size_t bufferSize ):
+        impl( std::make_unique< IMPL >( path, bufferSize ) )
+    {}
+    
+    BinaryFileStream::BinaryFileStream( const BinaryFileStream & o ):
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    BinaryFileStream::BinaryFileStream( BinaryFileStream && o ) noexcept:
+        impl( std::move( o.impl ) )
     {}
     
     BinaryFileStream::~BinaryFileStream()
     {}
     
+    BinaryFileStream & BinaryFileStream::operator =( BinaryFileStream o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
     void BinaryFileStream::Read( uint8_t * buf, size_t size )
     {
-        if( this->impl->_stream.is_open() == false )
+        size_t n;
+        
+        if( this->impl->_file->_isOpen == false )
         {
             throw std::runtime_error( "Invalid file stream" );
         }
@@ -72,9 +136,46 @@ namespace ISOBMFF
             throw std::runtime_error( "Invalid read - Not enough data available" );
         }
         
-        this->impl->_pos += size;
+        if( size == 0 )
+        {
+            return;
+        }
         
-        this->impl->_stream.read( reinterpret_cast< char * >( buf ), numeric_cast< std::streamsize >( size ) );
+        /*
+         * Consumes what is already available in the buffer first.
+         */
+        if( this->impl->_pos >= this->impl->_bufferPos && this->impl->_pos < this->impl->_bufferPos + this->impl->_bufferLength )
+        {
+            n = std::min( size, this->impl->_bufferPos + this->impl->_bufferLength - this->impl->_pos );
+            
+            memcpy( buf, this->impl->_buffer.data() + ( this->impl->_pos - this->impl->_bufferPos ), n );
+            
+            buf              += n;
+            size             -= n;
+            this->impl->_pos += n;
+        }
+        
+        if( size == 0 )
+        {
+            return;
+        }
+        
+        /*
+         * Large reads bypass the buffer, as there's nothing to gain from
+         * copying them twice.
+         */
+        if( size >= this->impl->_buffer.size() )
+        {
+            this->impl->_file->Read( this->impl->_pos, buf, size );
+        }
+        else
+        {
+            this->impl->Fill( this->impl->_pos );
+            
+            memcpy( buf, this->impl->_buffer.data(), size );
+        }
+        
+        this->impl->_pos += size;
     }
     
     void BinaryFileStream::Seek( std::streamoff offset, SeekDirection dir )
@@ -113,14 +214,15 @@ namespace ISOBMFF
             throw std::runtime_error( "Invalid seek offset" );
         }
         
+        /*
+         * Reads are positional, so seeking never reaches the file.
+         */
         this->impl->_pos = pos;
-        
-        this->impl->_stream.seekg( numeric_cast< std::streamsize >( pos ), std::ios_base::beg );
     }
     
     size_t BinaryFileStream::Tell() const
     {
-        if( this->impl->_stream.is_open() == false )
+        if( this->impl->_file->_isOpen == false )
         {
             throw std::runtime_error( "Invalid file stream" );
         }
@@ -128,35 +230,264 @@ namespace ISOBMFF
         return this->impl->_pos;
     }
     
-    BinaryFileStream::IMPL::IMPL( const std::string & path ):
+    size_t BinaryFileStream::Size() const
+    {
+        if( this->impl->_file->_isOpen == false )
+        {
+            throw std::runtime_error( "Invalid file stream" );
+        }
+        
+        return this->impl->_size;
+    }
+    
+    void BinaryFileStream::ReadAt( uint64_t offset, uint8_t * buf, size_t size ) const
+    {
+        if( this->impl->_file->_isOpen == false )
+        {
+            throw std::runtime_error( "Invalid file stream" );
+        }
+        
+        if( offset > this->impl->_size || size > this->impl->_size - offset )
+        {
+            throw std::runtime_error( "Invalid read - Not enough data available" );
+        }
+        
+        /*
+         * The read-ahead buffer belongs to the stream's cursor, so it's not
+         * used here, as it may be refilled by another thread at any time.
+         */
+        this->impl->_file->Read( offset, buf, size );
+    }
+    
+    void BinaryFileStream::Get( uint8_t * buf, uint64_t pos, size_t length )
+    {
+        size_t start;
+        
+        if( this->impl->_file->_isOpen == false )
+        {
+            throw std::runtime_error( "Invalid file stream" );
+        }
+        
+        if( pos > this->impl->_size - this->impl->_pos || length > this->impl->_size - this->impl->_pos - pos )
+        {
+            throw std::runtime_error( "Invalid read - Not enough data available" );
+        }
+        
+        start = this->impl->_pos + static_cast< size_t >( pos );
+        
+        if( length == 0 )
+        {
+            return;
+        }
+        
+        if( this->impl->IsBuffered( start, length ) == false )
+        {
+            /*
+             * Peeks are usually followed by a read at the current position,
+             * so fill the buffer from there if both fit in it.
+             */
+            if( start + length - this->impl->_pos <= this->impl->_buffer.size() )
+            {
+                this->impl->Fill( this->impl->_pos );
+            }
+            else
+            {
+                this->impl->_file->Read( start, buf, length );
+                
+                return;
+            }
+        }
+        
+        memcpy( buf, this->impl->_buffer.data() + ( start - this->impl->_bufferPos ), length );
+    }
+    
+    const uint8_t * BinaryFileStream::GetContiguousBytes( size_t size )
+    {
+        if( this->impl->_file->_isOpen == false || size > this->impl->_size - this->impl->_pos )
+        {
+            return nullptr;
+        }
+        
+        /*
+         * Only data fitting in the read-ahead buffer can be exposed.
+         */
+        if( size == 0 || size > this->impl->_buffer.size() )
+        {
+            return nullptr;
+        }
+        
+        if( this->impl->IsBuffered( this->impl->_pos, size ) == false )
+        {
+            this->impl->Fill( this->impl->_pos );
+        }
+        
+        return this->impl->_buffer.data() + ( this->impl->_pos - this->impl->_bufferPos );
+    }
+    
+    size_t BinaryFileStream::GetBufferSize() const
+    {
+        return this->impl->_buffer.size();
+    }
+    
+    void swap( BinaryFileStream & o1, BinaryFileStream & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    BinaryFileStream::IMPL::IMPL( const std::string & path, size_t bufferSize ):
+        _file( std::make_shared< File >( path ) ),
         _path( path ),
+        _size( _file->_size ),
+        _pos(  0 ),
+        _buffer( bufferSize ),
+        _bufferPos( 0 ),
+        _bufferLength( 0 )
+    {}
+    
+    BinaryFileStream::IMPL::IMPL( const IMPL & o ):
+        _file( o._file ),
+        _path( o._path ),
+        _size( o._size ),
+        _pos(  o._pos ),
+        _buffer( o._buffer.size() ),
+        _bufferPos( 0 ),
+        _bufferLength( 0 )
+    {}
+    
+    BinaryFileStream::IMPL::~IMPL()
+    {}
+    
+    void BinaryFileStream::IMPL::Fill( size_t pos )
+    {
+        size_t length;
+        
+        length = std::min( this->_buffer.size(), this->_size - pos );
+        
+        this->_bufferLength = 0;
+        
+        this->_file->Read( pos, this->_buffer.data(), length );
+        
+        this->_bufferPos    = pos;
+        this->_bufferLength = length;
+    }
+    
+    bool BinaryFileStream::IMPL::IsBuffered( size_t pos, size_t size ) const
+    {
+        return pos >= this->_bufferPos && size <= this->_bufferLength && pos - this->_bufferPos <= this->_bufferLength - size;
+    }
+    
+    #ifdef _WIN32
+    
+    BinaryFileStream::IMPL::File::File( const std::string & path ):
         _size( 0 ),
-        _pos(  0 )
+        _isOpen( false ),
+        _handle( INVALID_HANDLE_VALUE )
     {
-        #ifdef _WIN32
-        this->_stream.open( ISOBMFF::StringToWideString( path ), std::ios::binary );
-        #else
-        this->_stream.open( path, std::ios::binary );
-        #endif
+        LARGE_INTEGER size;
+        
+        this->_handle = CreateFileW( ISOBMFF::StringToWideString( path ).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+        
+        if( this->_handle == INVALID_HANDLE_VALUE || GetFileSizeEx( this->_handle, &size ) == FALSE )
+        {
+            return;
+        }
         
-        if( this->_stream.good() )
+        this->_size   = numeric_cast< size_t >( static_cast< uint64_t >( size.QuadPart ) );
+        this->_isOpen = true;
+    }
+    
+    BinaryFileStream::IMPL::File::~File()
+    {
+        if( this->_handle != INVALID_HANDLE_VALUE )
+        {
+            CloseHandle( this->_handle );
+        }
+    }
+    
+    void BinaryFileStream::IMPL::File::Read( uint64_t offset, uint8_t * buf, size_t size ) const
+    {
+        while( size > 0 )
         {
-            std::streamsize pos;
+            OVERLAPPED overlapped;
+            DWORD      length;
+            DWORD      n;
             
-            this->_stream.seekg( 0, std::ios_base::end );
+            memset( &overlapped, 0, sizeof( OVERLAPPED ) );
             
-            pos         = this->_stream.tellg();
-            this->_size = numeric_cast< size_t >( pos );
+            overlapped.Offset     = static_cast< DWORD >( offset & 0xFFFFFFFF );
+            overlapped.OffsetHigh = static_cast< DWORD >( offset >> 32 );
+            length                = static_cast< DWORD >( std::min< size_t >( size, 0x40000000 ) );
+            n                     = 0;
+            
+            if( ReadFile( this->_handle, buf, length, &n, &overlapped ) == FALSE || n == 0 )
+            {
+                throw std::runtime_error( "Invalid read - Cannot read from file" );
+            }
             
-            this->_stream.seekg( 0, std::ios_base::beg );
+            buf    += n;
+            size   -= n;
+            offset += n;
         }
     }
     
-    BinaryFileStream::IMPL::~IMPL()
+    #else
+    
+    BinaryFileStream::IMPL::File::File( const std::string & path ):
+        _size( 0 ),
+        _isOpen( false ),
+        _fd( -1 )
     {
-        if( this->_stream.is_open() )
+        struct stat st;
+        
+        this->_fd = open( path.c_str(), O_RDONLY );
+        
+        if( this->_fd == -1 )
         {
-            this->_stream.close();
+            return;
         }
+        
+        if( fstat( this->_fd, &st ) != 0 || S_ISREG( st.st_mode ) == false )
+        {
+            return;
+        }
+        
+        this->_size   = numeric_cast< size_t >( static_cast< uint64_t >( st.st_size ) );
+        this->_isOpen = true;
     }
+    
+    BinaryFileStream::IMPL::File::~File()
+    {
+        if( this->_fd != -1 )
+        {
+            close( this->_fd );
+        }
+    }
+    
+    void BinaryFileStream::IMPL::File::Read( uint64_t offset, uint8_t * buf, size_t size ) const
+    {
+        while( size > 0 )
+        {
+            ssize_t n;
+            
+            n = pread( this->_fd, buf, size, numeric_cast< off_t >( offset ) );
+            
+            if( n < 0 && errno == EINTR )
+            {
+                continue;
+            }
+            
+            if( n <= 0 )
+            {
+                throw std::runtime_error( "Invalid read - Cannot read from file" );
+            }
+            
+            buf    += n;
+            size   -= static_cast< size_t >( n );
+            offset += static_cast< uint64_t >( n );
+        }
+    }
+    
+    #endif
 }
@@ -0,0 +1,262 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        BinarySliceStream.cpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#include <cmath>
+#include <ISOBMFF/BinarySliceStream.hpp>
+#include <ISOBMFF/Casts.hpp>
+
+namespace ISOBMFF
+{
+    class BinarySliceStream::IMPL
+    {
+        public:
+            
+            IMPL( BinaryStream & stream, uint64_t offset, uint64_t length );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            BinaryStream * _stream;
+            uint64_t       _offset;
+            uint64_t       _length;
+            uint64_t       _pos;
+    };
+    
+    BinarySliceStream::BinarySliceStream( BinaryStream & stream, uint64_t offset, uint64_t length ):
+        impl( std::make_unique< IMPL >( stream, offset, length ) )
+    {}
+    
+    BinarySliceStream::BinarySliceStream( const BinarySliceStream & o ):
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    BinarySliceStream::BinarySliceStream( BinarySliceStream && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {}
+    
+    BinarySliceStream::~BinarySliceStream()
+    {}
+    
+    BinarySliceStream & BinarySliceStream::operator =( BinarySliceStream o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    void BinarySliceStream::Read( uint8_t * buf, size_t size )
+    {
+        uint64_t pos;
+        
+        if( size > this->impl->_length - this->impl->_pos )
+        {
+            throw std::runtime_error( "Invalid read - Not enough data available" );
+        }
+        
+        pos = this->impl->_offset + this->impl->_pos;
+        
+        /*
+         * Sequential reads leave the parent stream at the right place, so
+         * avoid seeking it again, as seeking may be expensive.
+         */
+        if( this->impl->_stream->Tell() != pos )
+        {
+            this->impl->_stream->Seek( pos, SeekDirection::Begin );
+        }
+        
+        this->impl->_stream->Read( buf, size );
+        
+        this->impl->_pos += size;
+    }
+    
+    void BinarySliceStream::Seek( std::streamoff offset, SeekDirection dir )
+    {
+        uint64_t pos;
+        
+        if( dir == SeekDirection::Begin )
+        {
+            if( offset < 0 )
+            {
+                throw std::runtime_error( "Invalid seek offset" );
+            }
+            
+            pos = numeric_cast< uint64_t >( offset );
+        }
+        else if( dir == SeekDirection::End )
+        {
+            if( offset > 0 || numeric_cast< uint64_t >( std::abs( offset ) ) > this->impl->_length )
+            {
+                throw std::runtime_error( "Invalid seek offset" );
+            }
+            
+            pos = this->impl->_length - numeric_cast< uint64_t >( std::abs( offset ) );
+        }
+        else if( offset < 0 )
+        {
+            if( numeric_cast< uint64_t >( std::abs( offset ) ) > this->impl->_pos )
+            {
+                throw std::runtime_error( "Invalid seek offset" );
+            }
+            
+            pos = this->impl->_pos - numeric_cast< uint64_t >( std::abs( offset ) );
+        }
+        else
+        {
+            pos = this->impl->_pos + numeric_cast< uint64_t >( offset );
+        }
+        
+        if( pos > this->impl->_length )
+        {
+            throw std::runtime_error( "Invalid seek offset" );
+        }
+        
+        this->impl->_pos = pos;
+    }
+    
+    size_t BinarySliceStream::Tell() const
+    {
+        return numeric_cast< size_t >( this->impl->_pos );
+    }
+    
+    size_t BinarySliceStream::Size() const
+    {
+        return numeric_cast< size_t >( this->impl->_length );
+    }
+    
+    void BinarySliceStream::ReadAt( uint64_t offset, uint8_t * buf, size_t size ) const
+    {
+        if( offset > this->impl->_length || size > this->impl->_length - offset )
+        {
+            throw std::runtime_error( "Invalid read - Not enough data available" );
+        }
+        
+        this->impl->_stream->ReadAt( this->impl->_offset + offset, buf, size );
+    }
+    
+    DataView BinarySliceStream::ReadViewAt( uint64_t offset, size_t size ) const
+    {
+        if( offset > this->impl->_length || size > this->impl->_length - offset )
+        {
+            throw std::runtime_error( "Invalid read - Not enough data available" );
+        }
+        
+        return this->impl->_stream->ReadViewAt( this->impl->_offset + offset, size );
+    }
+    
+    const uint8_t * BinarySliceStream::GetContiguousBytes( size_t size )
+    {
+        uint64_t pos;
+        
+        if( size > this->impl->_length - this->impl->_pos )
+        {
+            return nullptr;
+        }
+        
+        pos = this->impl->_offset + this->impl->_pos;
+        
+        if( this->impl->_stream->Tell() != pos )
+        {
+            this->impl->_stream->Seek( pos, SeekDirection::Begin );
+        }
+        
+        return this->impl->_stream->GetContiguousBytes( size );
+    }
+    
+    DataView BinarySliceStream::ReadView( size_t size )
+    {
+        DataView view;
+        uint64_t pos;
+        
+        if( size > this->impl->_length - this->impl->_pos )
+        {
+            throw std::runtime_error( "Invalid read - Not enough data available" );
+        }
+        
+        pos = this->impl->_offset + this->impl->_pos;
+        
+        if( this->impl->_stream->Tell() != pos )
+        {
+            this->impl->_stream->Seek( pos, SeekDirection::Begin );
+        }
+        
+        view              = this->impl->_stream->ReadView( size );
+        this->impl->_pos += size;
+        
+        return view;
+    }
+    
+    uint64_t BinarySliceStream::GetOffset() const
+    {
+        return this->impl->_offset;
+    }
+    
+    uint64_t BinarySliceStream::GetLength() const
+    {
+        return this->impl->_length;
+    }
+    
+    void swap( BinarySliceStream & o1, BinarySliceStream & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    BinarySliceStream::IMPL::IMPL( BinaryStream & stream, uint64_t offset, uint64_t length ):
+        _stream( &stream ),
+        _offset( offset ),
+        _length( length ),
+        _pos( 0 )
+    {
+        BinarySliceStream * slice;
+        
+        slice = dynamic_cast< BinarySliceStream * >( &stream );
+        
+        if( slice != nullptr )
+        {
+            if( offset > slice->impl->_length || length > slice->impl->_length - offset )
+            {
+                throw std::runtime_error( "Invalid slice - Out of parent bounds" );
+            }
+            
+            this->_stream  = slice->impl->_stream;
+            this->_offset += slice->impl->_offset;
+        }
+    }
+    
+    BinarySliceStream::IMPL::IMPL( const IMPL & o ):
+        _stream( o._stream ),
+        _offset( o._offset ),
+        _length( o._length ),
+        _pos( o._pos )
+    {}
+    
+    BinarySliceStream::IMPL::~IMPL()
+    {}
+}
@@ -30,28 +30,166 @@
  */
 
 #include <fstream>
+#include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
 #include <ISOBMFF/BinaryStream.hpp>
 
+#ifdef _MSC_VER
+#include <stdlib.h>
+#endif
+
+#if defined( __BYTE_ORDER__ ) && defined( __ORDER_BIG_ENDIAN__ ) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define ISOBMFF_BIG_ENDIAN_HOST 1
+#endif
+
 namespace ISOBMFF
 {
-    bool BinaryStream::HasBytesAvailable()
+    static inline uint16_t ByteSwap16( uint16_t n )
     {
-        return this->AvailableBytes() > 0;
+        return static_cast< uint16_t >( ( n >> 8 ) | ( n << 8 ) );
     }
     
-    size_t BinaryStream::AvailableBytes()
+    static inline uint32_t ByteSwap32( uint32_t n )
     {
-        size_t cur( this->Tell() );
-        size_t pos;
+        #if defined( _MSC_VER )
+        return _byteswap_ulong( n );
+        #elif defined( __GNUC__ )
+        return __builtin_bswap32( n );
+        #else
+        return ( n >> 24 ) | ( ( n >> 8 ) & 0x0000FF00 ) | ( ( n << 8 ) & 0x00FF0000 ) | ( n << 24 );
+        #endif
+    }
+    
+    static inline uint64_t ByteSwap64( uint64_t n )
+    {
+        #if defined( _MSC_VER )
+        return _byteswap_uint64( n );
+        #elif defined( __GNUC__ )
+        return __builtin_bswap64( n );
+        #else
+        return ( static_cast< uint64_t >( ByteSwap32( static_cast< uint32_t >( n ) ) ) << 32 ) | ByteSwap32( static_cast< uint32_t >( n >> 32 ) );
+        #endif
+    }
+    
+    /*
+     * Swaps the bytes of an array of n elements of the given size, in place.
+     * The array doesn't need to be aligned.
+     */
+    static void ByteSwapArray( uint8_t * p, size_t n, size_t size )
+    {
+        size_t i;
+        size_t length;
         
-        this->Seek( 0, SeekDirection::End );
+        length = n * size;
         
-        pos = this->Tell();
+        for( i = 0; i < length; i += size )
+        {
+            if( size == 2 )
+            {
+                uint16_t v;
+                
+                memcpy( &v, p + i, 2 );
+                
+                v = ByteSwap16( v );
+                
+                memcpy( p + i, &v, 2 );
+            }
+            else if( size == 4 )
+            {
+                uint32_t v;
+                
+                memcpy( &v, p + i, 4 );
+                
+                v = ByteSwap32( v );
+                
+                memcpy( p + i, &v, 4 );
+            }
+            else
+            {
+                uint64_t v;
+                
+                memcpy( &v, p + i, 8 );
+                
+                v = ByteSwap64( v );
+                
+                memcpy( p + i, &v, 8 );
+            }
+        }
+    }
+    
+    /*
+     * Reads n big-endian values of the given size, with a single read, and
+     * converts them to the host byte order.
+     */
+    static void ReadBigEndianArray( BinaryStream & stream, uint8_t * out, size_t n, size_t size )
+    {
+        if( n == 0 )
+        {
+            return;
+        }
         
-        this->Seek( numeric_cast< std::streamoff >( cur ), SeekDirection::Begin );
+        if( n > std::numeric_limits< size_t >::max() / size )
+        {
+            throw std::runtime_error( "Invalid read - Not enough data available" );
+        }
         
-        return pos - cur;
+        stream.Read( out, n * size );
+        
+        #ifndef ISOBMFF_BIG_ENDIAN_HOST
+        ByteSwapArray( out, n, size );
+        #endif
+    }
+    
+    size_t BinaryStream::Size() const
+    {
+        BinaryStream * stream( const_cast< BinaryStream * >( this ) );
+        size_t         cur( stream->Tell() );
+        size_t         size;
+        
+        stream->Seek( 0, SeekDirection::End );
+        
+        size = stream->Tell();
+        
+        stream->Seek( numeric_cast< std::streamoff >( cur ), SeekDirection::Begin );
+        
+        return size;
+    }
+    
+    void BinaryStream::ReadAt( uint64_t offset, uint8_t * buf, size_t size ) const
+    {
+        BinaryStream * stream( const_cast< BinaryStream * >( this ) );
+        size_t         cur( stream->Tell() );
+        
+        stream->Seek( numeric_cast< std::streamoff >( offset ), SeekDirection::Begin );
+        
+        try
+        {
+            stream->Read( buf, size );
+        }
+        catch( ... )
+        {
+            stream->Seek( numeric_cast< std::streamoff >( cur ), SeekDirection::Begin );
+            
+            throw;
+        }
+        
+        stream->Seek( numeric_cast< std::streamoff >( cur ), SeekDirection::Begin );
+    }
+    
+    bool BinaryStream::HasBytesAvailable()
+    {
+        return this->AvailableBytes() > 0;
+    }
+    
+    size_t BinaryStream::AvailableBytes()
+    {
+        size_t pos( this->Tell() );
+        size_t size( this->Size() );
+        
+        return ( pos < size ) ? size - pos : 0;
     }
     
     void BinaryStream::Seek( std::streamoff offset )
@@ -68,6 +206,30 @@ namespace ISOBMFF
         this->Seek( cur, SeekDirection::Begin );
     }
     
+    const uint8_t * BinaryStream::GetContiguousBytes( size_t size )
+    {
+        ( void )size;
+        
+        return nullptr;
+    }
+    
+    DataView BinaryStream::ReadView( size_t size )
+    {
+        return DataView( this->Read( size ) );
+    }
+    
+    DataView BinaryStream::ReadViewAt( uint64_t offset, size_t size ) const
+    {
+        std::vector< uint8_t > data( size, 0 );
+        
+        if( size > 0 )
+        {
+            this->ReadAt( offset, &( data[ 0 ] ), size );
+        }
+        
+        return DataView( std::move( data ) );
+    }
+    
     std::vector< uint8_t > BinaryStream::Read( size_t size )
     {
         std::vector< uint8_t > data( size, 0 );
@@ -330,6 +492,21 @@ namespace ISOBMFF
         return n;
     }
     
+    void BinaryStream::ReadBigEndianUInt16Array( uint16_t * out, size_t n )
+    {
+        ReadBigEndianArray( *( this ), reinterpret_cast< uint8_t * >( out ), n, sizeof( uint16_t ) );
+    }
+    
+    void BinaryStream::ReadBigEndianUInt32Array( uint32_t * out, size_t n )
+    {
+        ReadBigEndianArray( *( this ), reinterpret_cast< uint8_t * >( out ), n, sizeof( uint32_t ) );
+    }
+    
+    void BinaryStream::ReadBigEndianUInt64Array( uint64_t * out, size_t n )
+    {
+        ReadBigEndianArray( *( this ), reinterpret_cast< uint8_t * >( out ), n, sizeof( uint64_t ) );
+    }
+    
     float BinaryStream::ReadBigEndianFixedPoint( unsigned int integerLength, unsigned int fractionalLength )
     {
         uint32_t     n;
@@ -406,48 +583,84 @@ namespace ISOBMFF
     
     std::string BinaryStream::ReadString( size_t length )
     {
-        std::vector< char > cp( length + 1, 0 );
+        std::string s( length, 0 );
+        const void * end;
         
-        this->Read( reinterpret_cast< uint8_t * >( &( cp[ 0 ] ) ), length );
+        if( length == 0 )
+        {
+            return s;
+        }
         
-        return &( cp[ 0 ] );
+        this->Read( reinterpret_cast< uint8_t * >( &( s[ 0 ] ) ), length );
+        
+        end = memchr( s.data(), 0, length );
+        
+        if( end != nullptr )
+        {
+            s.resize( numeric_cast< size_t >( static_cast< const char * >( end ) - s.data() ) );
+        }
+        
+        return s;
     }
     
     std::string BinaryStream::ReadNULLTerminatedString()
     {
-        char        c;
-        std::string s;
-        
+        std::string     s;
+        uint8_t         buf[ 256 ];
+        const uint8_t * p;
+        const void    * end;
+        size_t          available;
+        size_t          n;
+        
+        available = this->AvailableBytes();
+        
+        /*
+         * Scans the data in chunks, exposed directly by the stream when
+         * possible, so the string is built with as few reads as possible.
+         */
         while( 1 )
         {
-            c = 0;
+            if( available == 0 )
+            {
+                throw std::runtime_error( "Invalid read - Not enough data available" );
+            }
+            
+            n = std::min< size_t >( available, 4096 );
+            p = this->GetContiguousBytes( n );
+            
+            if( p == nullptr )
+            {
+                n = std::min< size_t >( n, sizeof( buf ) );
+                p = buf;
+                
+                this->Get( buf, 0, n );
+            }
             
-            this->Read( reinterpret_cast< uint8_t * >( &c ), 1 );
+            end = memchr( p, 0, n );
             
-            if( c == 0 )
+            if( end != nullptr )
             {
-                break;
+                n = numeric_cast< size_t >( static_cast< const uint8_t * >( end ) - p );
+                
+                s.append( reinterpret_cast< const char * >( p ), n );
+                this->Seek( n + 1 );
+                
+                return s;
             }
             
-            s.append( 1, c );
+            s.append( reinterpret_cast< const char * >( p ), n );
+            this->Seek( n );
+            
+            available -= n;
         }
-        
-        return s;
     }
     
     Matrix BinaryStream::ReadMatrix()
     {
-        return Matrix
-        (
-            this->ReadBigEndianUInt32(),
-            this->ReadBigEndianUInt32(),
-            this->ReadBigEndianUInt32(),
-            this->ReadBigEndianUInt32(),
-            this->ReadBigEndianUInt32(),
-            this->ReadBigEndianUInt32(),
-            this->ReadBigEndianUInt32(),
-            this->ReadBigEndianUInt32(),
-            this->ReadBigEndianUInt32()
-        );
+        uint32_t m[ 9 ];
+        
+        this->ReadBigEndianUInt32Array( m, 9 );
+        
+        return Matrix( m[ 0 ], m[ 1 ], m[ 2 ], m[ 3 ], m[ 4 ], m[ 5 ], m[ 6 ], m[ 7 ], m[ 8 ] );
     }
 }
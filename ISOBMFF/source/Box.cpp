@@ -43,9 +43,11 @@ namespace ISOBMFF
             IMPL( const IMPL & o );
             ~IMPL();
             
-            std::string            _name;
-            std::vector< uint8_t > _data;
-            bool                   _hasData;
+            std::string                    _name;
+            FourCC                         _type;
+            DataView                       _data;
+            bool                           _hasData;
+            std::function< void( Box & ) > _lazyRead;
     };
     
     Box::Box( const std::string & name ):
@@ -84,19 +86,67 @@ namespace ISOBMFF
         return this->impl->_name;
     }
     
+    FourCC Box::GetType() const
+    {
+        return this->impl->_type;
+    }
+    
     void Box::ReadData( Parser & parser, BinaryStream & stream )
     {
         ( void )parser;
         
-        this->impl->_data    = stream.ReadAllData();
+        this->impl->_data    = stream.ReadView( stream.AvailableBytes() );
         this->impl->_hasData = true;
     }
     
     std::vector< uint8_t > Box::GetData() const
     {
+        return this->GetDataView().GetVector();
+    }
+    
+    DataView Box::GetDataView() const
+    {
+        this->Load();
+        
         return this->impl->_data;
     }
     
+    void Box::SetLazyData( const std::function< void( Box & ) > & read )
+    {
+        this->impl->_lazyRead = read;
+    }
+    
+    bool Box::IsLoaded() const
+    {
+        return this->impl->_lazyRead == nullptr;
+    }
+    
+    void Box::Load() const
+    {
+        std::function< void( Box & ) > read;
+        
+        if( this->impl->_lazyRead == nullptr )
+        {
+            return;
+        }
+        
+        /* Cleared first, so getters called while reading don't recurse */
+        read                  = std::move( this->impl->_lazyRead );
+        this->impl->_lazyRead = nullptr;
+        
+        try
+        {
+            read( const_cast< Box & >( *( this ) ) );
+        }
+        catch( ... )
+        {
+            /* Not loaded, so the next access fails again */
+            this->impl->_lazyRead = std::move( read );
+            
+            throw;
+        }
+    }
+    
     std::vector< std::pair< std::string, std::string > > Box::GetDisplayableProperties() const
     {
         return {};
@@ -104,13 +154,16 @@ namespace ISOBMFF
     
     Box::IMPL::IMPL( const std::string & name ):
         _name( name ),
+        _type( ( name.size() == 4 ) ? FourCC( name ) : FourCC() ),
         _hasData( false )
     {}
 
     Box::IMPL::IMPL( const IMPL & o ):
         _name( o._name ),
+        _type( o._type ),
         _data( o._data ),
-        _hasData( o._hasData )
+        _hasData( o._hasData ),
+        _lazyRead( o._lazyRead )
     {}
 
     Box::IMPL::~IMPL()
@@ -0,0 +1,310 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @file        BoxLayout.cpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#include <ISOBMFF/BoxLayout.hpp>
+#include <ISOBMFF/Parser.hpp>
+#include <ISOBMFF/BinaryFileStream.hpp>
+#include <ISOBMFF/BinaryDataReader.hpp>
+#include <cstring>
+#include <stdexcept>
+
+namespace ISOBMFF
+{
+    class BoxLayout::IMPL
+    {
+        public:
+            
+            IMPL();
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            void     ScanBoxes( const Parser & parser, BinaryStream & stream, uint64_t start, uint64_t end, uint32_t depth );
+            uint64_t GetChildBoxesOffset( const Parser & parser, BinaryStream & stream, FourCC type, uint64_t start, uint64_t end );
+            
+            std::vector< Entry > _entries;
+            bool                 _truncated;
+    };
+    
+    static const Parser & DefaultParser()
+    {
+        static const Parser parser;
+        
+        return parser;
+    }
+    
+    BoxLayout::BoxLayout():
+        impl( std::make_unique< IMPL >() )
+    {}
+    
+    BoxLayout::BoxLayout( const std::string & path ):
+        impl( std::make_unique< IMPL >() )
+    {
+        BinaryFileStream stream( path );
+        
+        this->Scan( DefaultParser(), stream );
+    }
+    
+    BoxLayout::BoxLayout( BinaryStream & stream ):
+        impl( std::make_unique< IMPL >() )
+    {
+        this->Scan( DefaultParser(), stream );
+    }
+    
+    BoxLayout::BoxLayout( const Parser & parser, BinaryStream & stream ):
+        impl( std::make_unique< IMPL >() )
+    {
+        this->Scan( parser, stream );
+    }
+    
+    BoxLayout::BoxLayout( const BoxLayout & o ):
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    BoxLayout::BoxLayout( BoxLayout && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {
+        o.impl = nullptr;
+    }
+    
+    BoxLayout::~BoxLayout()
+    {}
+    
+    BoxLayout & BoxLayout::operator =( BoxLayout o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    void swap( BoxLayout & o1, BoxLayout & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    void BoxLayout::Scan( const Parser & parser, BinaryStream & stream )
+    {
+        this->impl->_entries.clear();
+        
+        this->impl->_truncated = false;
+        
+        this->impl->ScanBoxes( parser, stream, 0, stream.Size(), 0 );
+    }
+    
+    const std::vector< BoxLayout::Entry > & BoxLayout::GetEntries() const
+    {
+        return this->impl->_entries;
+    }
+    
+    bool BoxLayout::IsTruncated() const
+    {
+        return this->impl->_truncated;
+    }
+    
+    BoxLayout::Entry BoxLayout::ReadEntry( BinaryStream & stream, uint64_t offset, uint64_t end, uint32_t depth )
+    {
+        uint8_t  header[ 16 ];
+        uint64_t size;
+        uint64_t available;
+        uint32_t headerSize;
+        FourCC   type;
+        
+        available = ( offset < end ) ? end - offset : 0;
+        
+        if( available < 8 )
+        {
+            throw std::runtime_error( "Invalid box header - Not enough data available" );
+        }
+        
+        stream.ReadAt( offset, header, 8 );
+        
+        {
+            BinaryDataReader reader( header, 8 );
+            
+            size = reader.ReadBigEndianUInt32();
+            type = FourCC( reader.ReadBigEndianUInt32() );
+        }
+        
+        headerSize = ( size == 1 ) ? 16 : 8;
+        
+        if( type == FourCC( "uuid" ) )
+        {
+            headerSize += 16;
+        }
+        
+        if( headerSize > available )
+        {
+            return Entry( type, offset, size, headerSize, depth, true );
+        }
+        
+        if( size == 1 )
+        {
+            stream.ReadAt( offset + 8, header + 8, 8 );
+            
+            size = BinaryDataReader( header + 8, 8 ).ReadBigEndianUInt64();
+        }
+        else if( size == 0 && depth == 0 )
+        {
+            /* Last box, extending to the end of the file */
+            size = available;
+        }
+        
+        return Entry( type, offset, size, headerSize, depth, size < headerSize || size > available );
+    }
+    
+    BoxLayout::Entry::Entry( FourCC type, uint64_t offset, uint64_t size, uint32_t headerSize, uint32_t depth, bool truncated ):
+        _type( type ),
+        _offset( offset ),
+        _size( size ),
+        _headerSize( headerSize ),
+        _depth( depth ),
+        _truncated( truncated )
+    {}
+    
+    FourCC BoxLayout::Entry::GetType() const
+    {
+        return this->_type;
+    }
+    
+    uint64_t BoxLayout::Entry::GetOffset() const
+    {
+        return this->_offset;
+    }
+    
+    uint64_t BoxLayout::Entry::GetSize() const
+    {
+        return this->_size;
+    }
+    
+    uint32_t BoxLayout::Entry::GetHeaderSize() const
+    {
+        return this->_headerSize;
+    }
+    
+    uint32_t BoxLayout::Entry::GetDepth() const
+    {
+        return this->_depth;
+    }
+    
+    bool BoxLayout::Entry::IsTruncated() const
+    {
+        return this->_truncated;
+    }
+    
+    BoxLayout::IMPL::IMPL():
+        _truncated( false )
+    {}
+    
+    BoxLayout::IMPL::IMPL( const IMPL & o ):
+        _entries( o._entries ),
+        _truncated( o._truncated )
+    {}
+    
+    BoxLayout::IMPL::~IMPL()
+    {}
+    
+    void BoxLayout::IMPL::ScanBoxes( const Parser & parser, BinaryStream & stream, uint64_t start, uint64_t end, uint32_t depth )
+    {
+        uint64_t offset;
+        uint64_t size;
+        
+        for( offset = start; end - offset >= 8; offset += size )
+        {
+            Entry entry( ReadEntry( stream, offset, end, depth ) );
+            
+            this->_entries.push_back( entry );
+            
+            size = entry.GetSize();
+            
+            if( entry.GetHeaderSize() > end - offset )
+            {
+                this->_truncated = true;
+                
+                return;
+            }
+            
+            if( size >= entry.GetHeaderSize() && parser.IsContainerBox( entry.GetType() ) )
+            {
+                uint64_t children;
+                uint64_t last;
+                
+                last     = offset + std::min( size, end - offset );
+                children = this->GetChildBoxesOffset( parser, stream, entry.GetType(), offset + entry.GetHeaderSize(), last );
+                
+                if( children <= last - offset - entry.GetHeaderSize() )
+                {
+                    this->ScanBoxes( parser, stream, offset + entry.GetHeaderSize() + children, last, depth + 1 );
+                }
+            }
+            
+            if( entry.IsTruncated() )
+            {
+                this->_truncated = true;
+                
+                return;
+            }
+        }
+        
+        /* Trailing bytes too small for a box header */
+        if( depth == 0 && offset < end )
+        {
+            this->_truncated = true;
+        }
+    }
+    
+    uint64_t BoxLayout::IMPL::GetChildBoxesOffset( const Parser & parser, BinaryStream & stream, FourCC type, uint64_t start, uint64_t end )
+    {
+        uint8_t data[ 8 ];
+        
+        /* Same checks as in META and IINF */
+        if( type == FourCC( "meta" ) && end - start >= 8 )
+        {
+            stream.ReadAt( start, data, 8 );
+            
+            if( memcmp( data + 4, "hdlr", 4 ) == 0 )
+            {
+                return 0;
+            }
+        }
+        else if( type == FourCC( "iinf" ) && end - start >= 1 )
+        {
+            stream.ReadAt( start, data, 1 );
+            
+            if( data[ 0 ] != 0 )
+            {
+                return 8;
+            }
+        }
+        
+        return parser.GetChildBoxesOffset( type );
+    }
+}
@@ -0,0 +1,321 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @file        BoxVisitor.cpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#include <ISOBMFF/BoxVisitor.hpp>
+#include <ISOBMFF/Box.hpp>
+#include <ISOBMFF/FTYP.hpp>
+#include <ISOBMFF/MVHD.hpp>
+#include <ISOBMFF/TKHD.hpp>
+#include <ISOBMFF/HDLR.hpp>
+#include <ISOBMFF/PITM.hpp>
+#include <ISOBMFF/ILOC.hpp>
+#include <ISOBMFF/INFE.hpp>
+#include <ISOBMFF/IROT.hpp>
+#include <ISOBMFF/HVCC.hpp>
+#include <ISOBMFF/COLR.hpp>
+#include <ISOBMFF/ISPE.hpp>
+#include <ISOBMFF/IPMA.hpp>
+#include <ISOBMFF/PIXI.hpp>
+#include <ISOBMFF/SIDX.hpp>
+#include <ISOBMFF/MFHD.hpp>
+#include <ISOBMFF/TFHD.hpp>
+#include <ISOBMFF/TREX.hpp>
+
+namespace ISOBMFF
+{
+    BoxVisitor::~BoxVisitor()
+    {}
+    
+    bool BoxVisitor::OnBoxBegin( FourCC type, uint64_t offset, uint64_t size, uint32_t depth )
+    {
+        ( void )type;
+        ( void )offset;
+        ( void )size;
+        ( void )depth;
+        
+        return true;
+    }
+    
+    void BoxVisitor::OnBoxEnd( FourCC type, uint32_t depth )
+    {
+        ( void )type;
+        ( void )depth;
+    }
+    
+    void BoxVisitor::OnBox( const Box & box )
+    {
+        /* Box classes can be replaced by custom registrations, hence the casts */
+        switch( box.GetType().GetValue() )
+        {
+            case FourCC( "ftyp" ).GetValue():
+                
+                if( auto typed = dynamic_cast< const FTYP * >( &box ) )
+                {
+                    this->OnFTYP( *( typed ) );
+                }
+                
+                break;
+                
+            case FourCC( "mvhd" ).GetValue():
+                
+                if( auto typed = dynamic_cast< const MVHD * >( &box ) )
+                {
+                    this->OnMVHD( *( typed ) );
+                }
+                
+                break;
+                
+            case FourCC( "tkhd" ).GetValue():
+                
+                if( auto typed = dynamic_cast< const TKHD * >( &box ) )
+                {
+                    this->OnTKHD( *( typed ) );
+                }
+                
+                break;
+                
+            case FourCC( "hdlr" ).GetValue():
+                
+                if( auto typed = dynamic_cast< const HDLR * >( &box ) )
+                {
+                    this->OnHDLR( *( typed ) );
+                }
+                
+                break;
+                
+            case FourCC( "pitm" ).GetValue():
+                
+                if( auto typed = dynamic_cast< const PITM * >( &box ) )
+                {
+                    this->OnPITM( *( typed ) );
+                }
+                
+                break;
+                
+            case FourCC( "iloc" ).GetValue():
+                
+                if( auto typed = dynamic_cast< const ILOC * >( &box ) )
+                {
+                    this->OnILOC( *( typed ) );
+                }
+                
+                break;
+                
+            case FourCC( "infe" ).GetValue():
+                
+                if( auto typed = dynamic_cast< const INFE * >( &box ) )
+                {
+                    this->OnINFE( *( typed ) );
+                }
+                
+                break;
+                
+            case FourCC( "irot" ).GetValue():
+                
+                if( auto typed = dynamic_cast< const IROT * >( &box ) )
+                {
+                    this->OnIROT( *( typed ) );
+                }
+                
+                break;
+                
+            case FourCC( "hvcC" ).GetValue():
+                
+                if( auto typed = dynamic_cast< const HVCC * >( &box ) )
+                {
+                    this->OnHVCC( *( typed ) );
+                }
+                
+                break;
+                
+            case FourCC( "colr" ).GetValue():
+                
+                if( auto typed = dynamic_cast< const COLR * >( &box ) )
+                {
+                    this->OnCOLR( *( typed ) );
+                }
+                
+                break;
+                
+            case FourCC( "ispe" ).GetValue():
+                
+                if( auto typed = dynamic_cast< const ISPE * >( &box ) )
+                {
+                    this->OnISPE( *( typed ) );
+                }
+                
+                break;
+                
+            case FourCC( "ipma" ).GetValue():
+                
+                if( auto typed = dynamic_cast< const IPMA * >( &box ) )
+                {
+                    this->OnIPMA( *( typed ) );
+                }
+                
+                break;
+                
+            case FourCC( "pixi" ).GetValue():
+                
+                if( auto typed = dynamic_cast< const PIXI * >( &box ) )
+                {
+                    this->OnPIXI( *( typed ) );
+                }
+                
+                break;
+                
+            case FourCC( "sidx" ).GetValue():
+                
+                if( auto typed = dynamic_cast< const SIDX * >( &box ) )
+                {
+                    this->OnSIDX( *( typed ) );
+                }
+                
+                break;
+                
+            case FourCC( "mfhd" ).GetValue():
+                
+                if( auto typed = dynamic_cast< const MFHD * >( &box ) )
+                {
+                    this->OnMFHD( *( typed ) );
+                }
+                
+                break;
+                
+            case FourCC( "tfhd" ).GetValue():
+                
+                if( auto typed = dynamic_cast< const TFHD * >( &box ) )
+                {
+                    this->OnTFHD( *( typed ) );
+                }
+                
+                break;
+                
+            case FourCC( "trex" ).GetValue():
+                
+                if( auto typed = dynamic_cast< const TREX * >( &box ) )
+                {
+                    this->OnTREX( *( typed ) );
+                }
+                
+                break;
+                
+            default:
+                
+                break;
+        }
+    }
+    
+    void BoxVisitor::OnFTYP( const FTYP & box )
+    {
+        ( void )box;
+    }
+    
+    void BoxVisitor::OnMVHD( const MVHD & box )
+    {
+        ( void )box;
+    }
+    
+    void BoxVisitor::OnTKHD( const TKHD & box )
+    {
+        ( void )box;
+    }
+    
+    void BoxVisitor::OnHDLR( const HDLR & box )
+    {
+        ( void )box;
+    }
+    
+    void BoxVisitor::OnPITM( const PITM & box )
+    {
+        ( void )box;
+    }
+    
+    void BoxVisitor::OnILOC( const ILOC & box )
+    {
+        ( void )box;
+    }
+    
+    void BoxVisitor::OnINFE( const INFE & box )
+    {
+        ( void )box;
+    }
+    
+    void BoxVisitor::OnIROT( const IROT & box )
+    {
+        ( void )box;
+    }
+    
+    void BoxVisitor::OnHVCC( const HVCC & box )
+    {
+        ( void )box;
+    }
+    
+    void BoxVisitor::OnCOLR( const COLR & box )
+    {
+        ( void )box;
+    }
+    
+    void BoxVisitor::OnISPE( const ISPE & box )
+    {
+        ( void )box;
+    }
+    
+    void BoxVisitor::OnIPMA( const IPMA & box )
+    {
+        ( void )box;
+    }
+    
+    void BoxVisitor::OnPIXI( const PIXI & box )
+    {
+        ( void )box;
+    }
+    
+    void BoxVisitor::OnSIDX( const SIDX & box )
+    {
+        ( void )box;
+    }
+    
+    void BoxVisitor::OnMFHD( const MFHD & box )
+    {
+        ( void )box;
+    }
+    
+    void BoxVisitor::OnTFHD( const TFHD & box )
+    {
+        ( void )box;
+    }
+    
+    void BoxVisitor::OnTREX( const TREX & box )
+    {
+        ( void )box;
+    }
+}
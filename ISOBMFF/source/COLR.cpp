@@ -47,7 +47,7 @@ namespace ISOBMFF
             uint16_t               _transferCharacteristics;
             uint16_t               _matrixCoefficients;
             bool                   _fullRangeFlag;
-            std::vector< uint8_t > _iccProfile;
+            DataView               _iccProfile;
     };
     
     COLR::COLR():
@@ -99,7 +99,7 @@ namespace ISOBMFF
         }
         else if( this->GetColourType() == "rICC" || this->GetColourType() == "prof" )
         {
-            this->SetICCProfile( stream.ReadAllData() );
+            this->SetICCProfile( stream.ReadView( stream.AvailableBytes() ) );
         }
         else
         {
@@ -123,13 +123,13 @@ namespace ISOBMFF
         else if( this->GetColourType() == "rICC" || this->GetColourType() == "prof" )
         {
             {
-                std::vector< uint8_t > data;
-                std::stringstream      ss;
-                std::string            s;
+                DataView          data;
+                std::stringstream ss;
+                std::string       s;
                 
-                data = this->GetICCProfile();
+                data = this->GetICCProfileView();
                 
-                if( data.size() > 0 )
+                if( data.GetSize() > 0 )
                 {
                     for( auto byte: data )
                     {
@@ -154,61 +154,99 @@ namespace ISOBMFF
     
     std::string COLR::GetColourType() const
     {
+        this->Load();
+        
         return this->impl->_colourType;
     }
     
     uint16_t COLR::GetColourPrimaries() const
     {
+        this->Load();
+        
         return this->impl->_colourPrimaries;
     }
     
     uint16_t COLR::GetTransferCharacteristics() const
     {
+        this->Load();
+        
         return this->impl->_transferCharacteristics;
     }
     
     uint16_t COLR::GetMatrixCoefficients() const
     {
+        this->Load();
+        
         return this->impl->_matrixCoefficients;
     }
     
     bool COLR::GetFullRangeFlag() const
     {
+        this->Load();
+        
         return this->impl->_fullRangeFlag;
     }
     
     std::vector< uint8_t > COLR::GetICCProfile() const
     {
+        this->Load();
+        
+        return this->impl->_iccProfile.GetVector();
+    }
+    
+    DataView COLR::GetICCProfileView() const
+    {
+        this->Load();
+        
         return this->impl->_iccProfile;
     }
     
     void COLR::SetColourType( const std::string & value )
     {
+        this->Load();
+        
         this->impl->_colourType = value;
     }
     
     void COLR::SetColourPrimaries( uint16_t value )
     {
+        this->Load();
+        
         this->impl->_colourPrimaries = value;
     }
     
     void COLR::SetTransferCharacteristics( uint16_t value )
     {
+        this->Load();
+        
         this->impl->_transferCharacteristics = value;
     }
     
     void COLR::SetMatrixCoefficients( uint16_t value )
     {
+        this->Load();
+        
         this->impl->_matrixCoefficients = value;
     }
     
     void COLR::SetFullRangeFlag( bool value )
     {
+        this->Load();
+        
         this->impl->_fullRangeFlag = value;
     }
     
     void COLR::SetICCProfile( const std::vector< uint8_t > & value )
     {
+        this->Load();
+        
+        this->impl->_iccProfile = DataView( value );
+    }
+    
+    void COLR::SetICCProfile( const DataView & value )
+    {
+        this->Load();
+        
         this->impl->_iccProfile = value;
     }
 
@@ -48,6 +48,7 @@ namespace ISOBMFF
             
             for( const auto & box: boxes )
             {
+                box->Load();
                 box->WriteDescription( os, indentLevel + 1 );
                 
                 os << std::endl;
@@ -63,14 +64,15 @@ namespace ISOBMFF
         Container::WriteBoxes( this->GetBoxes(), os, indentLevel );
     }
     
-    std::vector< std::shared_ptr< Box > > Container::GetBoxes( const std::string & name ) const
+    std::vector< std::shared_ptr< Box > > Container::GetBoxes( FourCC type ) const
     {
         std::vector< std::shared_ptr< Box > > boxes;
         
         for( const auto & box: this->GetBoxes() )
         {
-            if( box->GetName() == name )
+            if( box->GetType() == type )
             {
+                box->Load();
                 boxes.push_back( box );
             }
         }
@@ -78,17 +80,38 @@ namespace ISOBMFF
         return boxes;
     }
     
-    std::shared_ptr< Box > Container::GetBox( const std::string & name ) const
+    std::vector< std::shared_ptr< Box > > Container::GetBoxes( const std::string & name ) const
+    {
+        if( name.size() != 4 )
+        {
+            return {};
+        }
+        
+        return this->GetBoxes( FourCC( name ) );
+    }
+    
+    std::shared_ptr< Box > Container::GetBox( FourCC type ) const
     {
         for( const auto & box: this->GetBoxes() )
         {
-            if( box->GetName() == name )
+            if( box->GetType() == type )
             {
+                box->Load();
+                
                 return box;
             }
         }
         
         return nullptr;
     }
+    
+    std::shared_ptr< Box > Container::GetBox( const std::string & name ) const
+    {
+        if( name.size() != 4 )
+        {
+            return nullptr;
+        }
+        
+        return this->GetBox( FourCC( name ) );
+    }
 }
-
@@ -30,7 +30,8 @@
 
 #include <ISOBMFF/ContainerBox.hpp>
 #include <ISOBMFF/Parser.hpp>
-#include <ISOBMFF/BinaryDataStream.hpp>
+#include <ISOBMFF/BinarySliceStream.hpp>
+#include "ParserInternal.hpp"
 
 namespace ISOBMFF
 {
@@ -83,65 +84,64 @@ namespace ISOBMFF
 
     void ContainerBox::ReadData( Parser & parser, BinaryStream & stream )
     {
+        uint64_t               start;
         uint64_t               length;
-        std::string            name;
+        uint64_t               header;
+        FourCC                 type;
         std::shared_ptr< Box > box;
-        BinaryDataStream     * content;
         
         this->impl->_boxes.clear();
         
         while( stream.HasBytesAvailable() )
         {
-            ( void )parser;
-            
-            length   = stream.ReadBigEndianUInt32();
-            name     = stream.ReadFourCC();
-            content  = nullptr;
+            start  = stream.Tell();
+            length = stream.ReadBigEndianUInt32();
+            type   = FourCC( stream.ReadBigEndianUInt32() );
+            header = 8;
             
             if( length == 1 )
             {
                 length = stream.ReadBigEndianUInt64();
-                
-                if
-                (
-                       length > ( std::numeric_limits< size_t >::max )()
-                    || ( name == "mdat" && parser.HasOption( Parser::Options::SkipMDATData ) )
-                )
-                {
-                    stream.Seek( length - 16, BinaryStream::SeekDirection::Current );
-                }
-                else
-                {
-                    content = new BinaryDataStream( stream.Read( static_cast< size_t >( length ) - 16 ) );
-                }
+                header = 16;
             }
-            else
+            
+            if( length < header )
             {
-                if( name == "mdat" && parser.HasOption( Parser::Options::SkipMDATData ) )
-                {
-                    stream.Seek( length - 8, BinaryStream::SeekDirection::Current );
-                }
-                else
+                throw std::runtime_error( "Invalid box length" );
+            }
+            
+            if( length - header > stream.AvailableBytes() )
+            {
+                throw std::runtime_error( "Invalid read - Not enough data available" );
+            }
+            
+            if( ParserInternal::ShouldReadBox( parser, type ) == false )
+            {
+                if( this->HasIndexedBoxes() && ParserInternal::RetainsBoxes( parser ) )
                 {
-                    content = new BinaryDataStream( stream.Read( static_cast< uint32_t >( length ) - 8 ) );
+                    this->AddBox( parser.CreateObject< Box >( type.GetString() ) );
                 }
+                
+                stream.Seek( start + length, BinaryStream::SeekDirection::Begin );
+                
+                continue;
             }
             
-            box = parser.CreateBox( name );
+            box = this->CreateChildBox( parser, type );
             
             if( box != nullptr )
             {
-                if( content )
-                {
-                    box->ReadData( parser, *content );
-                }
+                BinarySliceStream content( stream, start + header, length - header );
                 
-                this->AddBox( box );
+                ParserInternal::ReadBoxData( parser, box, content, header );
             }
-            if( content )
+            
+            if( ParserInternal::RetainsBoxes( parser ) )
             {
-                delete( content );
+                this->AddBox( box );
             }
+            
+            stream.Seek( start + length, BinaryStream::SeekDirection::Begin );
         }
     }
     
@@ -155,6 +155,8 @@ namespace ISOBMFF
     
     std::vector< std::shared_ptr< Box > > ContainerBox::GetBoxes() const
     {
+        this->Load();
+        
         return this->impl->_boxes;
     }
     
@@ -164,6 +166,16 @@ namespace ISOBMFF
         Container::WriteBoxes( os, indentLevel );
     }
     
+    std::shared_ptr< Box > ContainerBox::CreateChildBox( const Parser & parser, FourCC type ) const
+    {
+        return parser.CreateBox( type );
+    }
+    
+    bool ContainerBox::HasIndexedBoxes() const
+    {
+        return false;
+    }
+    
     ContainerBox::IMPL::IMPL()
     {}
 
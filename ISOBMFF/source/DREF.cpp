@@ -107,6 +107,8 @@ namespace ISOBMFF
     
     std::vector< std::shared_ptr< Box > > DREF::GetBoxes() const
     {
+        this->Load();
+        
         return this->impl->_boxes;
     }
     
@@ -99,11 +99,15 @@ namespace ISOBMFF
     
     std::string FRMA::GetDataFormat() const
     {
+        this->Load();
+        
         return this->impl->_dataFormat;
     }
     
     void FRMA::SetDataFormat( const std::string & value )
     {
+        this->Load();
+        
         this->impl->_dataFormat = value;
     }
     
@@ -85,10 +85,22 @@ namespace ISOBMFF
     
     void FTYP::ReadData( Parser & parser, BinaryStream & stream )
     {
+        std::vector< uint8_t > brands;
+        
         this->SetMajorBrand( stream.ReadFourCC() );
         this->SetMinorVersion( stream.ReadBigEndianUInt32() );
         
-        while( stream.HasBytesAvailable() )
+        brands = stream.Read( ( stream.AvailableBytes() / 4 ) * 4 );
+        
+        for( size_t i = 0; i < brands.size(); i += 4 )
+        {
+            this->AddCompatibleBrand( std::string( reinterpret_cast< char * >( &( brands[ i ] ) ), 4 ) );
+        }
+        
+        /*
+         * Trailing bytes not making a full brand are still an error.
+         */
+        if( stream.HasBytesAvailable() )
         {
             this->AddCompatibleBrand( stream.ReadFourCC() );
         }
@@ -116,36 +128,50 @@ namespace ISOBMFF
     
     std::string FTYP::GetMajorBrand() const
     {
+        this->Load();
+        
         return this->impl->_majorBrand;
     }
     
     uint32_t FTYP::GetMinorVersion() const
     {
+        this->Load();
+        
         return this->impl->_minorVersion;
     }
     
     std::vector< std::string > FTYP::GetCompatibleBrands() const
     {
+        this->Load();
+        
         return this->impl->_compatibleBrands;
     }
     
     void FTYP::SetMajorBrand( const std::string & value )
     {
+        this->Load();
+        
         this->impl->_majorBrand = value;
     }
     
     void FTYP::SetMinorVersion( uint32_t value )
     {
+        this->Load();
+        
         this->impl->_minorVersion = value;
     }
     
     void FTYP::SetCompatibleBrands( const std::vector< std::string > & value )
     {
+        this->Load();
+        
         this->impl->_compatibleBrands = value;
     }
     
     void FTYP::AddCompatibleBrand( const std::string & value )
     {
+        this->Load();
+        
         this->impl->_compatibleBrands.push_back( value );
     }
     
@@ -0,0 +1,363 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @file        FlatFile.cpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#include <ISOBMFF/FlatFile.hpp>
+#include <ISOBMFF/Parser.hpp>
+#include <ISOBMFF/BinaryFileStream.hpp>
+#include "ParserInternal.hpp"
+#include <unordered_map>
+#include <stdexcept>
+
+namespace ISOBMFF
+{
+    class FlatFile::IMPL
+    {
+        public:
+            
+            IMPL();
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            bool BeginBox( const Parser & parser, const std::shared_ptr< Box > & box, uint64_t offset, uint64_t size );
+            void EndBox( const Parser & parser, const std::shared_ptr< Box > & box );
+            
+            std::vector< Node >                                                       _nodes;
+            std::unordered_map< FourCC, std::vector< std::shared_ptr< const Box > > > _boxes;
+            
+            /* Only used while parsing */
+            std::vector< uint32_t >                                                   _open;
+            std::vector< uint32_t >                                                   _last;
+    };
+    
+    const uint32_t FlatFile::NoNode;
+    
+    FlatFile::FlatFile():
+        impl( std::make_unique< IMPL >() )
+    {}
+    
+    FlatFile::FlatFile( const std::string & path ):
+        impl( std::make_unique< IMPL >() )
+    {
+        BinaryFileStream stream( path );
+        
+        this->Parse( Parser(), stream );
+    }
+    
+    FlatFile::FlatFile( BinaryStream & stream ):
+        impl( std::make_unique< IMPL >() )
+    {
+        this->Parse( Parser(), stream );
+    }
+    
+    FlatFile::FlatFile( const Parser & parser, BinaryStream & stream ):
+        impl( std::make_unique< IMPL >() )
+    {
+        this->Parse( parser, stream );
+    }
+    
+    FlatFile::FlatFile( const FlatFile & o ):
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    FlatFile::FlatFile( FlatFile && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {
+        o.impl = nullptr;
+    }
+    
+    FlatFile::~FlatFile()
+    {}
+    
+    FlatFile & FlatFile::operator =( FlatFile o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    void swap( FlatFile & o1, FlatFile & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    void FlatFile::Parse( const Parser & parser, BinaryStream & stream )
+    {
+        Parser decoder( parser );
+        
+        this->impl->_nodes.clear();
+        this->impl->_boxes.clear();
+        this->impl->_open.clear();
+        this->impl->_last.assign( 1, NoNode );
+        
+        decoder.RemoveOption( Parser::Options::LazyParsing );
+        decoder.AddOption( Parser::Options::SkipMDATData );
+        ParserInternal::SetRetainsBoxes( decoder, false );
+        ParserInternal::SetBoxHandlers
+        (
+            decoder,
+            [ & ]( const std::shared_ptr< Box > & box, uint64_t offset, uint64_t size, uint64_t ) -> bool
+            {
+                return this->impl->BeginBox( decoder, box, offset, size );
+            },
+            [ & ]( const std::shared_ptr< Box > & box )
+            {
+                this->impl->EndBox( decoder, box );
+            }
+        );
+        
+        try
+        {
+            decoder.Parse( stream );
+        }
+        catch( ... )
+        {
+            this->impl->_nodes.clear();
+            this->impl->_boxes.clear();
+            
+            throw;
+        }
+        
+        this->impl->_nodes.shrink_to_fit();
+        this->impl->_open.clear();
+        this->impl->_last.clear();
+    }
+    
+    const std::vector< FlatFile::Node > & FlatFile::GetNodes() const
+    {
+        return this->impl->_nodes;
+    }
+    
+    std::vector< uint32_t > FlatFile::FindNodes( FourCC type ) const
+    {
+        std::vector< uint32_t > nodes;
+        uint32_t                i;
+        
+        for( i = 0; i < this->impl->_nodes.size(); i++ )
+        {
+            if( this->impl->_nodes[ i ]._type == type )
+            {
+                nodes.push_back( i );
+            }
+        }
+        
+        return nodes;
+    }
+    
+    std::vector< uint32_t > FlatFile::FindNodes( const std::string & path ) const
+    {
+        std::vector< FourCC >   types;
+        std::vector< uint32_t > nodes;
+        size_t                  start;
+        size_t                  end;
+        uint32_t                i;
+        
+        for( start = 0; start <= path.length(); start = end + 1 )
+        {
+            end = path.find( '/', start );
+            
+            if( end == std::string::npos )
+            {
+                end = path.length();
+            }
+            
+            if( end > start )
+            {
+                types.push_back( FourCC( path.substr( start, end - start ) ) );
+            }
+        }
+        
+        if( types.size() == 0 )
+        {
+            return nodes;
+        }
+        
+        for( i = 0; i < this->impl->_nodes.size(); i++ )
+        {
+            uint32_t node;
+            size_t   n;
+            
+            for( node = i, n = types.size(); n > 0 && node != NoNode; node = this->impl->_nodes[ node ]._parent, n-- )
+            {
+                if( this->impl->_nodes[ node ]._type != types[ n - 1 ] )
+                {
+                    break;
+                }
+            }
+            
+            if( n == 0 )
+            {
+                nodes.push_back( i );
+            }
+        }
+        
+        return nodes;
+    }
+    
+    std::shared_ptr< const Box > FlatFile::GetBox( uint32_t node ) const
+    {
+        if( node >= this->impl->_nodes.size() || this->impl->_nodes[ node ]._box == NoNode )
+        {
+            return nullptr;
+        }
+        
+        return this->GetBoxes( this->impl->_nodes[ node ]._type )[ this->impl->_nodes[ node ]._box ];
+    }
+    
+    const std::vector< std::shared_ptr< const Box > > & FlatFile::GetBoxes( FourCC type ) const
+    {
+        static const std::vector< std::shared_ptr< const Box > > empty;
+        
+        auto it( this->impl->_boxes.find( type ) );
+        
+        return ( it == this->impl->_boxes.end() ) ? empty : it->second;
+    }
+    
+    FlatFile::Node::Node( FourCC type, uint64_t offset, uint64_t size, uint32_t parent, uint32_t depth ):
+        _type( type ),
+        _offset( offset ),
+        _size( size ),
+        _parent( parent ),
+        _firstChild( NoNode ),
+        _nextSibling( NoNode ),
+        _depth( depth ),
+        _box( NoNode )
+    {}
+    
+    FourCC FlatFile::Node::GetType() const
+    {
+        return this->_type;
+    }
+    
+    uint64_t FlatFile::Node::GetOffset() const
+    {
+        return this->_offset;
+    }
+    
+    uint64_t FlatFile::Node::GetSize() const
+    {
+        return this->_size;
+    }
+    
+    uint32_t FlatFile::Node::GetParent() const
+    {
+        return this->_parent;
+    }
+    
+    uint32_t FlatFile::Node::GetFirstChild() const
+    {
+        return this->_firstChild;
+    }
+    
+    uint32_t FlatFile::Node::GetNextSibling() const
+    {
+        return this->_nextSibling;
+    }
+    
+    uint32_t FlatFile::Node::GetDepth() const
+    {
+        return this->_depth;
+    }
+    
+    uint32_t FlatFile::Node::GetBoxIndex() const
+    {
+        return this->_box;
+    }
+    
+    FlatFile::IMPL::IMPL()
+    {}
+    
+    FlatFile::IMPL::IMPL( const IMPL & o ):
+        _nodes( o._nodes ),
+        _boxes( o._boxes )
+    {}
+    
+    FlatFile::IMPL::~IMPL()
+    {}
+    
+    bool FlatFile::IMPL::BeginBox( const Parser & parser, const std::shared_ptr< Box > & box, uint64_t offset, uint64_t size )
+    {
+        uint32_t index;
+        uint32_t depth;
+        uint32_t parent;
+        
+        if( this->_nodes.size() >= NoNode )
+        {
+            throw std::runtime_error( "Too many boxes" );
+        }
+        
+        index  = static_cast< uint32_t >( this->_nodes.size() );
+        depth  = static_cast< uint32_t >( this->_open.size() );
+        parent = ( depth == 0 ) ? NoNode : this->_open.back();
+        
+        this->_nodes.push_back( Node( box->GetType(), offset, size, parent, depth ) );
+        
+        if( this->_last[ depth ] != NoNode )
+        {
+            this->_nodes[ this->_last[ depth ] ]._nextSibling = index;
+        }
+        else if( parent != NoNode )
+        {
+            this->_nodes[ parent ]._firstChild = index;
+        }
+        
+        /* The children of the new node start a new sibling list */
+        this->_last.resize( depth + 2 );
+        
+        this->_last[ depth ]     = index;
+        this->_last[ depth + 1 ] = NoNode;
+        
+        this->_open.push_back( index );
+        
+        /* Unknown boxes are only represented by their node */
+        return parser.IsRegisteredBox( box->GetType() );
+    }
+    
+    void FlatFile::IMPL::EndBox( const Parser & parser, const std::shared_ptr< Box > & box )
+    {
+        Node & node = this->_nodes[ this->_open.back() ];
+        
+        this->_open.pop_back();
+        
+        /* Container boxes are only represented by their node */
+        if( node._firstChild != NoNode || parser.IsRegisteredBox( node._type ) == false )
+        {
+            return;
+        }
+        
+        std::vector< std::shared_ptr< const Box > > & boxes = this->_boxes[ node._type ];
+        
+        node._box = static_cast< uint32_t >( boxes.size() );
+        
+        boxes.push_back( box );
+    }
+}
@@ -106,21 +106,29 @@ namespace ISOBMFF
     
     uint8_t FullBox::GetVersion() const
     {
+        this->Load();
+        
         return this->impl->_version;
     }
     
     uint32_t FullBox::GetFlags() const
     {
+        this->Load();
+        
         return this->impl->_flags;
     }
     
     void FullBox::SetVersion( uint8_t value )
     {
+        this->Load();
+        
         this->impl->_version = value;
     }
     
     void FullBox::SetFlags( uint32_t value )
     {
+        this->Load();
+        
         this->impl->_flags = value;
     }
 
@@ -89,34 +89,41 @@ namespace ISOBMFF
     {
         FullBox::ReadData( parser, stream );
         
-        this->impl->_predefined = stream.ReadBigEndianUInt32();
-        
-        this->SetHandlerType( stream.ReadFourCC() );
-        
-        this->impl->_reserved[ 0 ] = stream.ReadBigEndianUInt32();
-        this->impl->_reserved[ 1 ] = stream.ReadBigEndianUInt32();
-        this->impl->_reserved[ 2 ] = stream.ReadBigEndianUInt32();
-        
-        if( stream.HasBytesAvailable() )
-        {
-            if
-            (
-                   parser.GetPreferredStringType() == Parser::StringType::Pascal
-                || this->impl->_predefined         == 1835560050 /* mhlr */
-                || this->impl->_reserved[ 0 ]      == 1634758764 /* appl */
-            )
-            {
-                this->SetHandlerName( stream.ReadPascalString() );
-            }
-            else
+        BinaryDataReader::Dispatch
+        (
+            stream,
+            [ & ]( auto & reader )
             {
-                this->SetHandlerName( stream.ReadNULLTerminatedString() );
+                this->impl->_predefined = reader.ReadBigEndianUInt32();
+                
+                this->SetHandlerType( reader.ReadFourCC() );
+                
+                this->impl->_reserved[ 0 ] = reader.ReadBigEndianUInt32();
+                this->impl->_reserved[ 1 ] = reader.ReadBigEndianUInt32();
+                this->impl->_reserved[ 2 ] = reader.ReadBigEndianUInt32();
+                
+                if( reader.HasBytesAvailable() )
+                {
+                    if
+                    (
+                           parser.GetPreferredStringType() == Parser::StringType::Pascal
+                        || this->impl->_predefined         == 1835560050 /* mhlr */
+                        || this->impl->_reserved[ 0 ]      == 1634758764 /* appl */
+                    )
+                    {
+                        this->SetHandlerName( reader.ReadPascalString() );
+                    }
+                    else
+                    {
+                        this->SetHandlerName( reader.ReadNULLTerminatedString() );
+                    }
+                }
+                else
+                {
+                    this->SetHandlerName( "" );
+                }
             }
-        }
-        else
-        {
-            this->SetHandlerName( "" );
-        }
+        );
     }
     
     std::vector< std::pair< std::string, std::string > > HDLR::GetDisplayableProperties() const
@@ -131,21 +138,29 @@ namespace ISOBMFF
     
     std::string HDLR::GetHandlerType() const
     {
+        this->Load();
+        
         return this->impl->_handlerType;
     }
     
     std::string HDLR::GetHandlerName() const
     {
+        this->Load();
+        
         return this->impl->_handlerName;
     }
     
     void HDLR::SetHandlerType( const std::string & value )
     {
+        this->Load();
+        
         this->impl->_handlerType = value;
     }
     
     void HDLR::SetHandlerName( const std::string & value )
     {
+        this->Load();
+        
         this->impl->_handlerName = value;
     }
 
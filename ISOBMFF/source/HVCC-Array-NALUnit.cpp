@@ -42,7 +42,7 @@ namespace ISOBMFF
             IMPL( const IMPL & o );
             ~IMPL();
             
-            std::vector< uint8_t > _data;
+            DataView _data;
     };
     
     HVCC::Array::NALUnit::NALUnit():
@@ -52,19 +52,11 @@ namespace ISOBMFF
     HVCC::Array::NALUnit::NALUnit( BinaryStream & stream ):
         impl( std::make_unique< IMPL >() )
     {
-        std::vector< uint8_t > data;
-        uint16_t               size;
+        uint16_t size;
         
         size = stream.ReadBigEndianUInt16();
         
-        if( size > 0 )
-        {
-            data = std::vector< uint8_t >( size );
-            
-            stream.Read( &( data[ 0 ] ), size );
-        }
-        
-        this->SetData( data );
+        this->SetData( stream.ReadView( size ) );
     }
     
     HVCC::Array::NALUnit::NALUnit( const HVCC::Array::NALUnit & o ):
@@ -100,24 +92,34 @@ namespace ISOBMFF
     }
     
     std::vector< uint8_t > HVCC::Array::NALUnit::GetData() const
+    {
+        return this->impl->_data.GetVector();
+    }
+    
+    DataView HVCC::Array::NALUnit::GetDataView() const
     {
         return this->impl->_data;
     }
     
     void HVCC::Array::NALUnit::SetData( const std::vector< uint8_t > & value )
+    {
+        this->impl->_data = DataView( value );
+    }
+    
+    void HVCC::Array::NALUnit::SetData( const DataView & value )
     {
         this->impl->_data = value;
     }
     
     std::vector< std::pair< std::string, std::string > > HVCC::Array::NALUnit::GetDisplayableProperties() const
     {
-        std::vector< uint8_t > data;
-        std::stringstream      ss;
-        std::string            s;
+        DataView          data;
+        std::stringstream ss;
+        std::string       s;
         
-        data = this->GetData();
+        data = this->GetDataView();
         
-        if( data.size() > 0 )
+        if( data.GetSize() > 0 )
         {
             for( auto byte: data )
             {
@@ -136,7 +138,7 @@ namespace ISOBMFF
         return
         {
             { "Data", s },
-            { "Size", std::to_string( data.size() ) }
+            { "Size", std::to_string( data.GetSize() ) }
         };
     }
     
@@ -106,8 +106,6 @@ namespace ISOBMFF
         uint8_t  count;
         uint8_t  i;
         
-        ( void )parser;
-        
         this->SetConfigurationVersion( stream.ReadUInt8() );
         
         u8 = stream.ReadUInt8();
@@ -165,7 +163,7 @@ namespace ISOBMFF
                 break;
             }
             
-            this->AddArray( std::make_shared< Array >( stream ) );
+            this->AddArray( parser.CreateObject< Array >( stream ) );
         }
     }
     
@@ -210,181 +208,253 @@ namespace ISOBMFF
     
     uint8_t HVCC::GetConfigurationVersion() const
     {
+        this->Load();
+        
         return this->impl->_configurationVersion;
     }
     
     uint8_t HVCC::GetGeneralProfileSpace() const
     {
+        this->Load();
+        
         return this->impl->_generalProfileSpace;
     }
     
     uint8_t HVCC::GetGeneralTierFlag() const
     {
+        this->Load();
+        
         return this->impl->_generalTierFlag;
     }
     
     uint8_t HVCC::GetGeneralProfileIDC() const
     {
+        this->Load();
+        
         return this->impl->_generalProfileIDC;
     }
     
     uint32_t HVCC::GetGeneralProfileCompatibilityFlags() const
     {
+        this->Load();
+        
         return this->impl->_generalProfileCompatibilityFlags;
     }
     
     uint64_t HVCC::GetGeneralConstraintIndicatorFlags() const
     {
+        this->Load();
+        
         return this->impl->_generalConstraintIndicatorFlags;
     }
     
     uint8_t HVCC::GetGeneralLevelIDC() const
     {
+        this->Load();
+        
         return this->impl->_generalLevelIDC;
     }
     
     uint16_t HVCC::GetMinSpatialSegmentationIDC() const
     {
+        this->Load();
+        
         return this->impl->_minSpatialSegmentationIDC;
     }
     
     uint8_t HVCC::GetParallelismType() const
     {
+        this->Load();
+        
         return this->impl->_parallelismType;
     }
     
     uint8_t HVCC::GetChromaFormat() const
     {
+        this->Load();
+        
         return this->impl->_chromaFormat;
     }
     
     uint8_t HVCC::GetBitDepthLumaMinus8() const
     {
+        this->Load();
+        
         return this->impl->_bitDepthLumaMinus8;
     }
     
     uint8_t HVCC::GetBitDepthChromaMinus8() const
     {
+        this->Load();
+        
         return this->impl->_bitDepthChromaMinus8;
     }
     
     uint16_t HVCC::GetAvgFrameRate() const
     {
+        this->Load();
+        
         return this->impl->_avgFrameRate;
     }
     
     uint8_t HVCC::GetConstantFrameRate() const
     {
+        this->Load();
+        
         return this->impl->_constantFrameRate;
     }
     
     uint8_t HVCC::GetNumTemporalLayers() const
     {
+        this->Load();
+        
         return this->impl->_numTemporalLayers;
     }
     
     uint8_t HVCC::GetTemporalIdNested() const
     {
+        this->Load();
+        
         return this->impl->_temporalIdNested;
     }
     
     uint8_t HVCC::GetLengthSizeMinusOne() const
     {
+        this->Load();
+        
         return this->impl->_lengthSizeMinusOne;
     }
     
     void HVCC::SetConfigurationVersion( uint8_t value )
     {
+        this->Load();
+        
         this->impl->_configurationVersion = value;
     }
     
     void HVCC::SetGeneralProfileSpace( uint8_t value )
     {
+        this->Load();
+        
         this->impl->_generalProfileSpace = value;
     }
     
     void HVCC::SetGeneralTierFlag( uint8_t value )
     {
+        this->Load();
+        
         this->impl->_generalTierFlag = value;
     }
     
     void HVCC::SetGeneralProfileIDC( uint8_t value )
     {
+        this->Load();
+        
         this->impl->_generalProfileIDC = value;
     }
     
     void HVCC::SetGeneralProfileCompatibilityFlags( uint32_t value )
     {
+        this->Load();
+        
         this->impl->_generalProfileCompatibilityFlags = value;
     }
     
     void HVCC::SetGeneralConstraintIndicatorFlags( uint64_t value )
     {
+        this->Load();
+        
         this->impl->_generalConstraintIndicatorFlags = value;
     }
     
     void HVCC::SetGeneralLevelIDC( uint8_t value )
     {
+        this->Load();
+        
         this->impl->_generalLevelIDC = value;
     }
     
     void HVCC::SetMinSpatialSegmentationIDC( uint16_t value )
     {
+        this->Load();
+        
         this->impl->_minSpatialSegmentationIDC = value;
     }
     
     void HVCC::SetParallelismType( uint8_t value )
     {
+        this->Load();
+        
         this->impl->_parallelismType = value;
     }
     
     void HVCC::SetChromaFormat( uint8_t value )
     {
+        this->Load();
+        
         this->impl->_chromaFormat = value;
     }
     
     void HVCC::SetBitDepthLumaMinus8( uint8_t value )
     {
+        this->Load();
+        
         this->impl->_bitDepthLumaMinus8 = value;
     }
     
     void HVCC::SetBitDepthChromaMinus8( uint8_t value )
     {
+        this->Load();
+        
         this->impl->_bitDepthChromaMinus8 = value;
     }
     
     void HVCC::SetAvgFrameRate( uint16_t value )
     {
+        this->Load();
+        
         this->impl->_avgFrameRate = value;
     }
     
     void HVCC::SetConstantFrameRate( uint8_t value )
     {
+        this->Load();
+        
         this->impl->_constantFrameRate = value;
     }
     
     void HVCC::SetNumTemporalLayers( uint8_t value )
     {
+        this->Load();
+        
         this->impl->_numTemporalLayers = value;
     }
     
     void HVCC::SetTemporalIdNested( uint8_t value )
     {
+        this->Load();
+        
         this->impl->_temporalIdNested = value;
     }
     
     void HVCC::SetLengthSizeMinusOne( uint8_t value )
     {
+        this->Load();
+        
         this->impl->_lengthSizeMinusOne = value;
     }
     
     std::vector< std::shared_ptr< HVCC::Array > > HVCC::GetArrays() const
     {
+        this->Load();
+        
         return this->impl->_arrays;
     }
     
     void HVCC::AddArray( std::shared_ptr< Array > array )
     {
+        this->Load();
+        
         this->impl->_arrays.push_back( array );
     }
 
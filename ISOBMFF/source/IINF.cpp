@@ -116,6 +116,8 @@ namespace ISOBMFF
     
     void IINF::AddEntry( std::shared_ptr< INFE > entry )
     {
+        this->Load();
+        
         if( entry != nullptr )
         {
             this->impl->_entries.push_back( entry );
@@ -124,13 +126,25 @@ namespace ISOBMFF
     
     std::vector< std::shared_ptr< INFE > > IINF::GetEntries() const
     {
+        this->Load();
+        
+        for( const auto & infe: this->impl->_entries )
+        {
+            infe->Load();
+        }
+        
         return this->impl->_entries;
     }
     
     std::shared_ptr< INFE > IINF::GetItemInfo( uint32_t itemID ) const
     {
-        for( const auto & infe: this->GetEntries() )
+        this->Load();
+        
+        /* Entries are loaded one at a time, rather than copied */
+        for( const auto & infe: this->impl->_entries )
         {
+            infe->Load();
+            
             if( infe->GetItemID() == itemID )
             {
                 return infe;
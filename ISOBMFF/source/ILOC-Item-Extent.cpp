@@ -51,6 +51,18 @@ namespace ISOBMFF
     
     ILOC::Item::Extent::Extent( BinaryStream & stream, const ILOC & iloc ):
         impl( std::make_unique< IMPL >() )
+    {
+        this->Read( stream, iloc );
+    }
+    
+    ILOC::Item::Extent::Extent( BinaryDataReader & stream, const ILOC & iloc ):
+        impl( std::make_unique< IMPL >() )
+    {
+        this->Read( stream, iloc );
+    }
+    
+    template< typename T >
+    void ILOC::Item::Extent::Read( T & stream, const ILOC & iloc )
     {
         if( ( iloc.GetVersion() == 1 || iloc.GetVersion() == 2 ) && iloc.GetIndexSize() > 0 )
         {
@@ -53,6 +53,18 @@ namespace ISOBMFF
     
     ILOC::Item::Item( BinaryStream & stream, const ILOC & iloc ):
         impl( std::make_unique< IMPL >() )
+    {
+        this->Read( stream, iloc );
+    }
+    
+    ILOC::Item::Item( BinaryDataReader & stream, const ILOC & iloc ):
+        impl( std::make_unique< IMPL >() )
+    {
+        this->Read( stream, iloc );
+    }
+    
+    template< typename T >
+    void ILOC::Item::Read( T & stream, const ILOC & iloc )
     {
         uint16_t count;
         uint16_t i;
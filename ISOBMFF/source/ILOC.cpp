@@ -29,6 +29,8 @@
  */
 
 #include <ISOBMFF/ILOC.hpp>
+#include <ISOBMFF/Parser.hpp>
+#include <unordered_map>
 
 namespace ISOBMFF
 {
@@ -45,6 +47,7 @@ namespace ISOBMFF
             uint8_t                                _baseOffsetSize;
             uint8_t                                _indexSize;
             std::vector< std::shared_ptr< Item > > _items;
+            std::unordered_map< uint32_t, size_t > _itemIndices;
     };
     
     ILOC::ILOC():
@@ -85,37 +88,45 @@ namespace ISOBMFF
     
     void ILOC::ReadData( Parser & parser, BinaryStream & stream )
     {
-        uint8_t  u8;
-        uint32_t count;
-        uint32_t i;
-        
         FullBox::ReadData( parser, stream );
         
-        u8 = stream.ReadUInt8();
-        
-        this->SetOffsetSize( u8 >> 4 );
-        this->SetLengthSize( u8 & 0xF );
-        
-        u8 = stream.ReadUInt8();
-        
-        this->SetBaseOffsetSize( u8 >> 4 );
-        this->SetIndexSize( u8 & 0xF );
-        
-        if( this->GetVersion() < 2 )
-        {
-            count = stream.ReadBigEndianUInt16();
-        }
-        else
-        {
-            count = stream.ReadBigEndianUInt32();
-        }
-        
-        this->impl->_items.clear();
-        
-        for( i = 0; i < count; i++ )
-        {
-            this->AddItem( std::make_shared< Item >( stream, *( this ) ) );
-        }
+        BinaryDataReader::Dispatch
+        (
+            stream,
+            [ & ]( auto & reader )
+            {
+                uint8_t  u8;
+                uint32_t count;
+                uint32_t i;
+                
+                u8 = reader.ReadUInt8();
+                
+                this->SetOffsetSize( u8 >> 4 );
+                this->SetLengthSize( u8 & 0xF );
+                
+                u8 = reader.ReadUInt8();
+                
+                this->SetBaseOffsetSize( u8 >> 4 );
+                this->SetIndexSize( u8 & 0xF );
+                
+                if( this->GetVersion() < 2 )
+                {
+                    count = reader.ReadBigEndianUInt16();
+                }
+                else
+                {
+                    count = reader.ReadBigEndianUInt32();
+                }
+                
+                this->impl->_items.clear();
+                this->impl->_itemIndices.clear();
+                
+                for( i = 0; i < count; i++ )
+                {
+                    this->AddItem( parser.CreateObject< Item >( reader, *( this ) ) );
+                }
+            }
+        );
     }
     
     void ILOC::WriteDescription( std::ostream & os, std::size_t indentLevel ) const
@@ -151,64 +162,91 @@ namespace ISOBMFF
     
     uint8_t ILOC::GetOffsetSize() const
     {
+        this->Load();
+        
         return this->impl->_offsetSize;
     }
     
     uint8_t ILOC::GetLengthSize() const
     {
+        this->Load();
+        
         return this->impl->_lengthSize;
     }
     
     uint8_t ILOC::GetBaseOffsetSize() const
     {
+        this->Load();
+        
         return this->impl->_baseOffsetSize;
     }
     
     uint8_t ILOC::GetIndexSize() const
     {
+        this->Load();
+        
         return this->impl->_indexSize;
     }
     
     void ILOC::SetOffsetSize( uint8_t value )
     {
+        this->Load();
+        
         this->impl->_offsetSize = value;
     }
     
     void ILOC::SetLengthSize( uint8_t value )
     {
+        this->Load();
+        
         this->impl->_lengthSize = value;
     }
     
     void ILOC::SetBaseOffsetSize( uint8_t value )
     {
+        this->Load();
+        
         this->impl->_baseOffsetSize = value;
     }
     
     void ILOC::SetIndexSize( uint8_t value )
     {
+        this->Load();
+        
         this->impl->_indexSize = value;
     }
     
     std::vector< std::shared_ptr< ILOC::Item > > ILOC::GetItems() const
     {
+        this->Load();
+        
         return this->impl->_items;
     }
     
     std::shared_ptr< ILOC::Item > ILOC::GetItem( uint32_t itemID ) const
     {
-        for( const auto & item: this->GetItems() )
+        this->Load();
+        
+        auto it = this->impl->_itemIndices.find( itemID );
+        
+        if( it == this->impl->_itemIndices.end() )
         {
-            if( item->GetItemID() == itemID )
-            {
-                return item;
-            }
+            return nullptr;
         }
         
-        return nullptr;
+        return this->impl->_items[ it->second ];
     }
     
     void ILOC::AddItem( std::shared_ptr< Item > item )
     {
+        this->Load();
+        
+        /* The first item with an ID is found by GetItem() */
+        if( item != nullptr )
+        {
+            this->impl->_itemIndices.emplace( item->GetItemID(), this->impl->_items.size() );
+        }
+        
         this->impl->_items.push_back( item );
     }
 
@@ -224,7 +262,8 @@ namespace ISOBMFF
         _lengthSize( o._lengthSize ),
         _baseOffsetSize( o._baseOffsetSize ),
         _indexSize( o._indexSize ),
-        _items( o._items )
+        _items( o._items ),
+        _itemIndices( o._itemIndices )
     {}
 
     ILOC::IMPL::~IMPL()
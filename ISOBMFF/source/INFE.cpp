@@ -90,89 +90,96 @@ namespace ISOBMFF
     {
         FullBox::ReadData( parser, stream );
         
-        if( this->GetVersion() == 0 || this->GetVersion() == 1 )
-        {
-            this->SetItemID( stream.ReadBigEndianUInt16() );
-            this->SetItemProtectionIndex( stream.ReadBigEndianUInt16() );
-            
-            if( parser.GetPreferredStringType() == Parser::StringType::Pascal )
-            {
-                this->SetItemName( stream.ReadPascalString() );
-                this->SetContentType( stream.ReadPascalString() );
-                this->SetContentEncoding( stream.ReadPascalString() );
-            }
-            else
-            {
-                this->SetItemName( stream.ReadNULLTerminatedString() );
-                this->SetContentType( stream.ReadNULLTerminatedString() );
-                this->SetContentEncoding( stream.ReadNULLTerminatedString() );
-            }
-        }
-        
-        /*
-        if( version == 1 )
-        {
-            unsigned int( 32 ) extension_type;   // optional
-            ItemInfoExtension( extension_type ); // optional
-        }
-        
-        aligned( 8 ) class ItemInfoExtension( unsigned int( 32 ) extension_type )
-        {}
-        
-        aligned( 8 ) class FDItemInfoExtension() extends ItemInfoExtension ( 'fdel' )
-        {
-            string             content_location;
-            string             content_MD5;
-            unsigned int( 64 ) content_length;
-            unsigned int( 64 ) transfer_length;
-            unsigned int( 8 )  entry_count;
-            
-            for( i = 1; i <= entry_count; i++ )
-            {
-                unsigned int( 32 ) group_id;
-            }
-        }
-        */
-        
-        if( this->GetVersion() >= 2 )
-        {
-            if( this->GetVersion() == 2 )
-            {
-                this->SetItemID( stream.ReadBigEndianUInt16() );
-            }
-            else if( this->GetVersion() == 3 )
-            {
-                this->SetItemID( stream.ReadBigEndianUInt32() );
-            }
-            
-            this->SetItemProtectionIndex( stream.ReadBigEndianUInt16() );
-            this->SetItemType( stream.ReadFourCC() );
-            
-            if( parser.GetPreferredStringType() == Parser::StringType::Pascal )
+        BinaryDataReader::Dispatch
+        (
+            stream,
+            [ & ]( auto & reader )
             {
-                if( this->GetItemType() == "mime" )
+                if( this->GetVersion() == 0 || this->GetVersion() == 1 )
                 {
-                    this->SetContentType( stream.ReadPascalString() );
-                    this->SetContentEncoding( stream.ReadPascalString() );
+                    this->SetItemID( reader.ReadBigEndianUInt16() );
+                    this->SetItemProtectionIndex( reader.ReadBigEndianUInt16() );
+                
+                    if( parser.GetPreferredStringType() == Parser::StringType::Pascal )
+                    {
+                        this->SetItemName( reader.ReadPascalString() );
+                        this->SetContentType( reader.ReadPascalString() );
+                        this->SetContentEncoding( reader.ReadPascalString() );
+                    }
+                    else
+                    {
+                        this->SetItemName( reader.ReadNULLTerminatedString() );
+                        this->SetContentType( reader.ReadNULLTerminatedString() );
+                        this->SetContentEncoding( reader.ReadNULLTerminatedString() );
+                    }
                 }
-                else if( this->GetItemType() == "uri " )
+                
+                /*
+                if( version == 1 )
                 {
-                    this->SetItemURIType( stream.ReadPascalString() );
+                    unsigned int( 32 ) extension_type;   // optional
+                    ItemInfoExtension( extension_type ); // optional
                 }
-            }
-            else
-            {
-                if( this->GetItemType() == "mime" )
+                
+                aligned( 8 ) class ItemInfoExtension( unsigned int( 32 ) extension_type )
+                {}
+                
+                aligned( 8 ) class FDItemInfoExtension() extends ItemInfoExtension ( 'fdel' )
                 {
-                    this->SetContentType( stream.ReadNULLTerminatedString() );
-                    this->SetContentEncoding( stream.ReadNULLTerminatedString() );
+                    string             content_location;
+                    string             content_MD5;
+                    unsigned int( 64 ) content_length;
+                    unsigned int( 64 ) transfer_length;
+                    unsigned int( 8 )  entry_count;
+                
+                    for( i = 1; i <= entry_count; i++ )
+                    {
+                        unsigned int( 32 ) group_id;
+                    }
                 }
-                else if( this->GetItemType() == "uri " )
+                */
+                
+                if( this->GetVersion() >= 2 )
                 {
-                    this->SetItemURIType( stream.ReadNULLTerminatedString() );
+                    if( this->GetVersion() == 2 )
+                    {
+                        this->SetItemID( reader.ReadBigEndianUInt16() );
+                    }
+                    else if( this->GetVersion() == 3 )
+                    {
+                        this->SetItemID( reader.ReadBigEndianUInt32() );
+                    }
+                
+                    this->SetItemProtectionIndex( reader.ReadBigEndianUInt16() );
+                    this->SetItemType( reader.ReadFourCC() );
+                
+                    if( parser.GetPreferredStringType() == Parser::StringType::Pascal )
+                    {
+                        if( this->GetItemType() == "mime" )
+                        {
+                            this->SetContentType( reader.ReadPascalString() );
+                            this->SetContentEncoding( reader.ReadPascalString() );
+                        }
+                        else if( this->GetItemType() == "uri " )
+                        {
+                            this->SetItemURIType( reader.ReadPascalString() );
+                        }
+                    }
+                    else
+                    {
+                        if( this->GetItemType() == "mime" )
+                        {
+                            this->SetContentType( reader.ReadNULLTerminatedString() );
+                            this->SetContentEncoding( reader.ReadNULLTerminatedString() );
+                        }
+                        else if( this->GetItemType() == "uri " )
+                        {
+                            this->SetItemURIType( reader.ReadNULLTerminatedString() );
+                        }
+                    }
                 }
             }
-        }
+        );
     }
     
     std::vector< std::pair< std::string, std::string > > INFE::GetDisplayableProperties() const
@@ -192,71 +199,99 @@ namespace ISOBMFF
     
     uint32_t INFE::GetItemID() const
     {
+        this->Load();
+        
         return this->impl->_itemID;
     }
     
     uint16_t INFE::GetItemProtectionIndex() const
     {
+        this->Load();
+        
         return this->impl->_itemProtectionIndex;
     }
     
     std::string INFE::GetItemType() const
     {
+        this->Load();
+        
         return this->impl->_itemType;
     }
     
     std::string INFE::GetItemName() const
     {
+        this->Load();
+        
         return this->impl->_itemName;
     }
     
     std::string INFE::GetContentType() const
     {
+        this->Load();
+        
         return this->impl->_contentType;
     }
     
     std::string INFE::GetContentEncoding() const
     {
+        this->Load();
+        
         return this->impl->_contentEncoding;
     }
     
     std::string INFE::GetItemURIType() const
     {
+        this->Load();
+        
         return this->impl->_itemURIType;
     }
     
     void INFE::SetItemID( uint32_t value )
     {
+        this->Load();
+        
         this->impl->_itemID = value;
     }
     
     void INFE::SetItemProtectionIndex( uint16_t value )
     {
+        this->Load();
+        
         this->impl->_itemProtectionIndex = value;
     }
     
     void INFE::SetItemType( const std::string & value )
     {
+        this->Load();
+        
         this->impl->_itemType = value;
     }
     
     void INFE::SetItemName( const std::string & value )
     {
+        this->Load();
+        
         this->impl->_itemName = value;
     }
     
     void INFE::SetContentType( const std::string & value )
     {
+        this->Load();
+        
         this->impl->_contentType = value;
     }
     
     void INFE::SetContentEncoding( const std::string & value )
     {
+        this->Load();
+        
         this->impl->_contentEncoding = value;
     }
     
     void INFE::SetItemURIType( const std::string & value )
     {
+        this->Load();
+        
         this->impl->_itemURIType = value;
     }
     
@@ -44,6 +44,8 @@ namespace ISOBMFF
             return nullptr;
         }
         
+        boxes[ index ]->Load();
+        
         return boxes[ index ];
     }
     
@@ -64,6 +66,8 @@ namespace ISOBMFF
             return nullptr;
         }
         
+        boxes[ index - 1 ]->Load();
+        
         return boxes[ index - 1 ];
     }
     
@@ -84,4 +88,10 @@ namespace ISOBMFF
         
         return boxes;
     }
+    
+    /* Properties are referenced by their index in IPMA entries */
+    bool IPCO::HasIndexedBoxes() const
+    {
+        return true;
+    }
 }
@@ -50,6 +50,18 @@ namespace ISOBMFF
     
     IPMA::Entry::Association::Association( BinaryStream & stream, const IPMA & ipma ):
         impl( std::make_unique< IMPL >() )
+    {
+        this->Read( stream, ipma );
+    }
+    
+    IPMA::Entry::Association::Association( BinaryDataReader & stream, const IPMA & ipma ):
+        impl( std::make_unique< IMPL >() )
+    {
+        this->Read( stream, ipma );
+    }
+    
+    template< typename T >
+    void IPMA::Entry::Association::Read( T & stream, const IPMA & ipma )
     {
         if( ipma.GetFlags() & 0x01 )
         {
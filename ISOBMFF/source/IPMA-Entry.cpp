@@ -50,6 +50,18 @@ namespace ISOBMFF
     
     IPMA::Entry::Entry( BinaryStream & stream, const IPMA & ipma ):
         impl( std::make_unique< IMPL >() )
+    {
+        this->Read( stream, ipma );
+    }
+    
+    IPMA::Entry::Entry( BinaryDataReader & stream, const IPMA & ipma ):
+        impl( std::make_unique< IMPL >() )
+    {
+        this->Read( stream, ipma );
+    }
+    
+    template< typename T >
+    void IPMA::Entry::Read( T & stream, const IPMA & ipma )
     {
         uint8_t count;
         uint8_t i;
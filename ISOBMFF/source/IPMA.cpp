@@ -29,6 +29,8 @@
  */
 
 #include <ISOBMFF/IPMA.hpp>
+#include <ISOBMFF/Parser.hpp>
+#include <unordered_map>
 
 namespace ISOBMFF
 {
@@ -41,6 +43,7 @@ namespace ISOBMFF
             ~IMPL();
             
             std::vector< std::shared_ptr< Entry > > _entries;
+            std::unordered_map< uint32_t, size_t >  _entryIndices;
     };
     
     IPMA::IPMA():
@@ -81,17 +84,24 @@ namespace ISOBMFF
     
     void IPMA::ReadData( Parser & parser, BinaryStream & stream )
     {
-        uint32_t count;
-        uint32_t i;
-        
         FullBox::ReadData( parser, stream );
         
-        count = stream.ReadBigEndianUInt32();
-        
-        for( i = 0; i < count; i++ )
-        {
-            this->AddEntry( std::make_shared< Entry >( stream, *( this ) ) );
-        }
+        BinaryDataReader::Dispatch
+        (
+            stream,
+            [ & ]( auto & reader )
+            {
+                uint32_t count;
+                uint32_t i;
+                
+                count = reader.ReadBigEndianUInt32();
+                
+                for( i = 0; i < count; i++ )
+                {
+                    this->AddEntry( parser.CreateObject< Entry >( reader, *( this ) ) );
+                }
+            }
+        );
     }
     
     void IPMA::WriteDescription( std::ostream & os, std::size_t indentLevel ) const
@@ -117,24 +127,35 @@ namespace ISOBMFF
     
     std::vector< std::shared_ptr< IPMA::Entry > > IPMA::GetEntries() const
     {
+        this->Load();
+        
         return this->impl->_entries;
     }
     
     std::shared_ptr< IPMA::Entry > IPMA::GetEntry( uint32_t itemID ) const
     {
-        for( const auto & entry: this->GetEntries() )
+        this->Load();
+        
+        auto it = this->impl->_entryIndices.find( itemID );
+        
+        if( it == this->impl->_entryIndices.end() )
         {
-            if( entry->GetItemID() == itemID )
-            {
-                return entry;
-            }
+            return nullptr;
         }
         
-        return nullptr;
+        return this->impl->_entries[ it->second ];
     }
     
     void IPMA::AddEntry( std::shared_ptr< Entry > entry )
     {
+        this->Load();
+        
+        /* The first entry for an item is found by GetEntry() */
+        if( entry != nullptr )
+        {
+            this->impl->_entryIndices.emplace( entry->GetItemID(), this->impl->_entries.size() );
+        }
+        
         this->impl->_entries.push_back( entry );
     }
 
@@ -142,7 +163,8 @@ namespace ISOBMFF
     {}
 
     IPMA::IMPL::IMPL( const IMPL & o ):
-        _entries( o._entries )
+        _entries( o._entries ),
+        _entryIndices( o._entryIndices )
     {}
 
     IPMA::IMPL::~IMPL()
@@ -31,9 +31,39 @@
 #include <ISOBMFF/IREF.hpp>
 #include <ISOBMFF/ContainerBox.hpp>
 #include <ISOBMFF/Parser.hpp>
+#include <ISOBMFF/SingleItemTypeReferenceBox.hpp>
 
 namespace ISOBMFF
 {
+    /*
+     * All boxes in an iref box are item references, even when their type
+     * is registered for another box, like iloc references.
+     */
+    class IREFContainer: public ContainerBox
+    {
+        public:
+            
+            IREFContainer():
+                ContainerBox( "????" )
+            {}
+            
+        protected:
+            
+            std::shared_ptr< Box > CreateChildBox( const Parser & parser, FourCC type ) const override
+            {
+                std::shared_ptr< Box > box;
+                
+                box = parser.CreateBox( type );
+                
+                if( std::dynamic_pointer_cast< SingleItemTypeReferenceBox >( box ) == nullptr )
+                {
+                    box = parser.CreateObject< SingleItemTypeReferenceBox >( type.GetString() );
+                }
+                
+                return box;
+            }
+    };
+    
     class IREF::IMPL
     {
         public:
@@ -83,7 +113,7 @@ namespace ISOBMFF
     
     void IREF::ReadData( Parser & parser, BinaryStream & stream )
     {
-        ContainerBox container( "????" );
+        IREFContainer container;
         
         FullBox::ReadData( parser, stream );
         parser.SetInfo( "iref", this );
@@ -109,6 +139,8 @@ namespace ISOBMFF
     
     std::vector< std::shared_ptr< Box > > IREF::GetBoxes() const
     {
+        this->Load();
+        
         return this->impl->_boxes;
     }
     
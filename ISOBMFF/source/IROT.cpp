@@ -102,11 +102,15 @@ namespace ISOBMFF
     
     uint8_t IROT::GetAngle() const
     {
+        this->Load();
+        
         return this->impl->_angle;
     }
     
     void IROT::SetAngle( uint8_t value )
     {
+        this->Load();
+        
         this->impl->_angle = value;
     }
     
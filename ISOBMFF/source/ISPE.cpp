@@ -100,21 +100,29 @@ namespace ISOBMFF
     
     uint32_t ISPE::GetDisplayWidth() const
     {
+        this->Load();
+        
         return this->impl->_displayWidth;
     }
     
     uint32_t ISPE::GetDisplayHeight() const
     {
+        this->Load();
+        
         return this->impl->_displayHeight;
     }
     
     void ISPE::SetDisplayWidth( uint32_t value )
     {
+        this->Load();
+        
         this->impl->_displayWidth = value;
     }
     
     void ISPE::SetDisplayHeight( uint32_t value )
     {
+        this->Load();
+        
         this->impl->_displayHeight = value;
     }
     
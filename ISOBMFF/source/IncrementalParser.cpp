@@ -0,0 +1,317 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+
+/*!
+ * @file        IncrementalParser.cpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#include <ISOBMFF/IncrementalParser.hpp>
+#include <ISOBMFF/BinaryDataStream.hpp>
+#include <ISOBMFF/BinaryDataReader.hpp>
+#include <ISOBMFF/BinarySliceStream.hpp>
+#include <ISOBMFF/MDAT.hpp>
+#include "ParserInternal.hpp"
+#include <stdexcept>
+
+namespace ISOBMFF
+{
+    class IncrementalParser::IMPL
+    {
+        public:
+            
+            IMPL( const Parser & parser, const Callback & callback );
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            void ReadHeader();
+            void ParseBox();
+            void ResetBox();
+            
+            /* Size of a box extending to the end of the stream */
+            static const uint64_t OpenEnded = UINT64_MAX;
+            
+            Parser                 _parser;
+            Callback               _callback;
+            Parser::StringType     _stringType;
+            std::vector< uint8_t > _buffer;
+            uint64_t               _offset;
+            uint64_t               _size;
+            uint64_t               _received;
+            uint64_t               _headerSize;
+            FourCC                 _type;
+            bool                   _skipData;
+    };
+    
+    IncrementalParser::IncrementalParser( const Callback & callback ):
+        impl( std::make_unique< IMPL >( Parser(), callback ) )
+    {}
+    
+    IncrementalParser::IncrementalParser( const Parser & parser, const Callback & callback ):
+        impl( std::make_unique< IMPL >( parser, callback ) )
+    {}
+    
+    IncrementalParser::IncrementalParser( const IncrementalParser & o ):
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    IncrementalParser::IncrementalParser( IncrementalParser && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {
+        o.impl = nullptr;
+    }
+    
+    IncrementalParser::~IncrementalParser()
+    {}
+    
+    IncrementalParser & IncrementalParser::operator =( IncrementalParser o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    void swap( IncrementalParser & o1, IncrementalParser & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    void IncrementalParser::Feed( const uint8_t * data, size_t size ) noexcept( false )
+    {
+        uint64_t n;
+        
+        while( size > 0 )
+        {
+            if( this->impl->_size == 0 )
+            {
+                n = std::min< uint64_t >( size, this->impl->_headerSize - this->impl->_buffer.size() );
+                
+                this->impl->_buffer.insert( this->impl->_buffer.end(), data, data + n );
+            }
+            else
+            {
+                n = std::min< uint64_t >( size, this->impl->_size - this->impl->_received );
+                
+                if( this->impl->_skipData == false )
+                {
+                    this->impl->_buffer.insert( this->impl->_buffer.end(), data, data + n );
+                }
+            }
+            
+            this->impl->_received += n;
+            this->impl->_offset   += n;
+            data                  += n;
+            size                  -= static_cast< size_t >( n );
+            
+            if( this->impl->_size == 0 && this->impl->_buffer.size() == this->impl->_headerSize )
+            {
+                this->impl->ReadHeader();
+            }
+            
+            if( this->impl->_size != 0 && this->impl->_received == this->impl->_size )
+            {
+                this->impl->ParseBox();
+            }
+        }
+    }
+    
+    void IncrementalParser::Finish() noexcept( false )
+    {
+        if( this->impl->_size == IMPL::OpenEnded )
+        {
+            this->impl->_size = this->impl->_received;
+            
+            try
+            {
+                this->impl->ParseBox();
+            }
+            catch( ... )
+            {
+                this->Reset();
+                
+                throw;
+            }
+        }
+        else if( this->impl->_received > 0 )
+        {
+            this->Reset();
+            
+            throw std::runtime_error( "Invalid read - Incomplete box at end of stream" );
+        }
+        
+        this->Reset();
+    }
+    
+    void IncrementalParser::Reset()
+    {
+        this->impl->ResetBox();
+        this->impl->_parser.SetPreferredStringType( this->impl->_stringType );
+        
+        this->impl->_offset = 0;
+    }
+    
+    uint64_t IncrementalParser::GetOffset() const
+    {
+        return this->impl->_offset;
+    }
+    
+    size_t IncrementalParser::GetBufferedSize() const
+    {
+        return this->impl->_buffer.size();
+    }
+    
+    IncrementalParser::IMPL::IMPL( const Parser & parser, const Callback & callback ):
+        _parser( parser ),
+        _callback( callback ),
+        _stringType( parser.GetPreferredStringType() ),
+        _offset( 0 ),
+        _size( 0 ),
+        _received( 0 ),
+        _headerSize( 8 ),
+        _skipData( false )
+    {
+        /* Boxes are parsed from the buffer, which is reused for the next box */
+        this->_parser.RemoveOption( Parser::Options::LazyParsing );
+    }
+    
+    IncrementalParser::IMPL::IMPL( const IMPL & o ):
+        _parser( o._parser ),
+        _callback( o._callback ),
+        _stringType( o._stringType ),
+        _buffer( o._buffer ),
+        _offset( o._offset ),
+        _size( o._size ),
+        _received( o._received ),
+        _headerSize( o._headerSize ),
+        _type( o._type ),
+        _skipData( o._skipData )
+    {}
+    
+    IncrementalParser::IMPL::~IMPL()
+    {}
+    
+    void IncrementalParser::IMPL::ReadHeader()
+    {
+        BinaryDataReader reader( this->_buffer.data(), this->_buffer.size() );
+        uint64_t         length;
+        FourCC           type;
+        
+        length = reader.ReadBigEndianUInt32();
+        type   = FourCC( reader.ReadBigEndianUInt32() );
+        
+        if( length == 1 && this->_headerSize == 8 )
+        {
+            this->_headerSize = 16;
+            
+            return;
+        }
+        
+        if( this->_headerSize == 16 )
+        {
+            length = reader.ReadBigEndianUInt64();
+        }
+        else if( length == 0 )
+        {
+            length = OpenEnded;
+        }
+        
+        if( length < this->_headerSize )
+        {
+            throw std::runtime_error( "Invalid box length" );
+        }
+        
+        this->_type = type;
+        this->_size = length;
+        
+        /* Data that won't be read is not buffered */
+        if( this->_type == FourCC( "mdat" ) && this->_parser.HasOption( Parser::Options::SkipMDATData ) )
+        {
+            this->_skipData = true;
+        }
+        else
+        {
+            this->_skipData = ParserInternal::ShouldReadBox( this->_parser, this->_type ) == false;
+        }
+    }
+    
+    void IncrementalParser::IMPL::ParseBox()
+    {
+        std::shared_ptr< Box >  box;
+        std::shared_ptr< MDAT > mdat;
+        
+        if( ParserInternal::ShouldReadBox( this->_parser, this->_type ) == false )
+        {
+            this->ResetBox();
+            
+            return;
+        }
+        
+        try
+        {
+            BinaryDataStream  stream( this->_buffer.data(), this->_buffer.size() );
+            BinarySliceStream content( stream, this->_headerSize, this->_buffer.size() - this->_headerSize );
+            
+            box = this->_parser.CreateBox( this->_type );
+            
+            ParserInternal::ReadBoxData( this->_parser, box, content, this->_headerSize );
+            
+            /* The buffer doesn't start at the box, and may not contain the data */
+            mdat = std::dynamic_pointer_cast< MDAT >( box );
+            
+            if( mdat != nullptr )
+            {
+                mdat->SetDataOffset( this->_offset - this->_received + this->_headerSize );
+                mdat->SetDataLength( this->_size - this->_headerSize );
+            }
+        }
+        catch( ... )
+        {
+            /* The next box can still be parsed */
+            this->ResetBox();
+            
+            throw;
+        }
+        
+        this->ResetBox();
+        
+        if( this->_callback != nullptr )
+        {
+            this->_callback( box );
+        }
+    }
+    
+    void IncrementalParser::IMPL::ResetBox()
+    {
+        this->_buffer.clear();
+        
+        this->_size       = 0;
+        this->_received   = 0;
+        this->_headerSize = 8;
+        this->_skipData   = false;
+    }
+}
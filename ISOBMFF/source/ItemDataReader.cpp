@@ -0,0 +1,463 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ItemDataReader.cpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#include <ISOBMFF/ItemDataReader.hpp>
+#include <ISOBMFF/File.hpp>
+#include <ISOBMFF/META.hpp>
+#include <ISOBMFF/ILOC.hpp>
+#include <ISOBMFF/IREF.hpp>
+#include <ISOBMFF/SingleItemTypeReferenceBox.hpp>
+#include <ISOBMFF/Casts.hpp>
+#include <unordered_map>
+#include <cstring>
+#include <stdexcept>
+
+namespace ISOBMFF
+{
+    class ItemDataReader::IMPL
+    {
+        public:
+            
+            IMPL();
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            void Load( const META & meta );
+            void AddItemRanges( uint32_t itemID, unsigned int depth, std::vector< Range > & ranges ) const;
+            
+            static void AddRange( std::vector< Range > & ranges, Source source, uint64_t offset, uint64_t length );
+            static void AddSubRanges( std::vector< Range > & ranges, const std::vector< Range > & from, uint64_t offset, uint64_t length );
+            
+            std::unordered_map< uint32_t, std::shared_ptr< ILOC::Item > > _items;
+            std::unordered_map< uint32_t, std::vector< uint32_t > >      _references;
+            std::shared_ptr< BinaryStream >                              _stream;
+            DataView                                                     _idat;
+    };
+    
+    ItemDataReader::Range::Range( Source source, uint64_t offset, uint64_t length ):
+        _source( source ),
+        _offset( offset ),
+        _length( length )
+    {}
+    
+    ItemDataReader::Source ItemDataReader::Range::GetSource() const
+    {
+        return this->_source;
+    }
+    
+    uint64_t ItemDataReader::Range::GetOffset() const
+    {
+        return this->_offset;
+    }
+    
+    uint64_t ItemDataReader::Range::GetLength() const
+    {
+        return this->_length;
+    }
+    
+    ItemDataReader::ItemDataReader():
+        impl( std::make_unique< IMPL >() )
+    {}
+    
+    ItemDataReader::ItemDataReader( const META & meta, const std::shared_ptr< BinaryStream > & stream ):
+        impl( std::make_unique< IMPL >() )
+    {
+        this->impl->_stream = stream;
+        
+        this->impl->Load( meta );
+    }
+    
+    ItemDataReader::ItemDataReader( const File & file, const std::shared_ptr< BinaryStream > & stream ):
+        impl( std::make_unique< IMPL >() )
+    {
+        std::shared_ptr< META > meta;
+        
+        meta = file.GetTypedBox< META >( "meta" );
+        
+        if( meta == nullptr )
+        {
+            throw std::runtime_error( "File has no meta box" );
+        }
+        
+        this->impl->_stream = stream;
+        
+        this->impl->Load( *( meta ) );
+    }
+    
+    ItemDataReader::ItemDataReader( const ItemDataReader & o ):
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    ItemDataReader::ItemDataReader( ItemDataReader && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {
+        o.impl = nullptr;
+    }
+    
+    ItemDataReader::~ItemDataReader()
+    {}
+    
+    ItemDataReader & ItemDataReader::operator =( ItemDataReader o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    void swap( ItemDataReader & o1, ItemDataReader & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    bool ItemDataReader::HasItem( uint32_t itemID ) const
+    {
+        return this->impl->_items.find( itemID ) != this->impl->_items.end();
+    }
+    
+    std::vector< ItemDataReader::Range > ItemDataReader::GetRanges( uint32_t itemID ) const
+    {
+        std::vector< Range > ranges;
+        
+        this->impl->AddItemRanges( itemID, 0, ranges );
+        
+        return ranges;
+    }
+    
+    uint64_t ItemDataReader::GetSize( uint32_t itemID ) const
+    {
+        uint64_t size;
+        
+        size = 0;
+        
+        for( const auto & range: this->GetRanges( itemID ) )
+        {
+            size += range.GetLength();
+        }
+        
+        return size;
+    }
+    
+    size_t ItemDataReader::Read( uint32_t itemID, uint8_t * buf, size_t size ) const
+    {
+        std::vector< Range > ranges;
+        uint64_t             total;
+        size_t               pos;
+        size_t               length;
+        
+        ranges = this->GetRanges( itemID );
+        total  = 0;
+        pos    = 0;
+        
+        for( const auto & range: ranges )
+        {
+            total += range.GetLength();
+        }
+        
+        if( total > size )
+        {
+            throw std::runtime_error( "Invalid read - Buffer is too small" );
+        }
+        
+        for( const auto & range: ranges )
+        {
+            length = numeric_cast< size_t >( range.GetLength() );
+            
+            if( range.GetSource() == Source::IDAT )
+            {
+                memcpy( buf + pos, this->impl->_idat.GetBytes() + range.GetOffset(), length );
+            }
+            else
+            {
+                this->impl->_stream->ReadAt( range.GetOffset(), buf + pos, length );
+            }
+            
+            pos += length;
+        }
+        
+        return pos;
+    }
+    
+    std::vector< uint8_t > ItemDataReader::GetData( uint32_t itemID ) const
+    {
+        std::vector< uint8_t > data;
+        
+        data.resize( numeric_cast< size_t >( this->GetSize( itemID ) ) );
+        
+        if( data.size() > 0 )
+        {
+            this->Read( itemID, &( data[ 0 ] ), data.size() );
+        }
+        
+        return data;
+    }
+    
+    DataView ItemDataReader::GetDataView( uint32_t itemID ) const
+    {
+        std::vector< Range > ranges;
+        
+        ranges = this->GetRanges( itemID );
+        
+        if( ranges.size() == 0 )
+        {
+            return {};
+        }
+        
+        if( ranges.size() > 1 )
+        {
+            return DataView( this->GetData( itemID ) );
+        }
+        
+        if( ranges[ 0 ].GetSource() == Source::IDAT )
+        {
+            return this->impl->_idat.GetSubView( numeric_cast< size_t >( ranges[ 0 ].GetOffset() ), numeric_cast< size_t >( ranges[ 0 ].GetLength() ) );
+        }
+        
+        return this->impl->_stream->ReadViewAt( ranges[ 0 ].GetOffset(), numeric_cast< size_t >( ranges[ 0 ].GetLength() ) );
+    }
+    
+    ItemDataReader::IMPL::IMPL()
+    {}
+    
+    ItemDataReader::IMPL::IMPL( const IMPL & o ):
+        _items( o._items ),
+        _references( o._references ),
+        _stream( o._stream ),
+        _idat( o._idat )
+    {}
+    
+    ItemDataReader::IMPL::~IMPL()
+    {}
+    
+    void ItemDataReader::IMPL::Load( const META & meta )
+    {
+        std::shared_ptr< ILOC > iloc;
+        std::shared_ptr< IREF > iref;
+        std::shared_ptr< Box >  idat;
+        
+        iloc = meta.GetTypedBox< ILOC >( "iloc" );
+        iref = meta.GetTypedBox< IREF >( "iref" );
+        idat = meta.GetBox( "idat" );
+        
+        if( iloc != nullptr )
+        {
+            for( const auto & item: iloc->GetItems() )
+            {
+                this->_items[ item->GetItemID() ] = item;
+            }
+        }
+        
+        if( iref != nullptr )
+        {
+            for( const auto & box: iref->GetBoxes() )
+            {
+                std::shared_ptr< SingleItemTypeReferenceBox > reference;
+                
+                box->Load();
+                
+                reference = std::dynamic_pointer_cast< SingleItemTypeReferenceBox >( box );
+                
+                if( reference == nullptr || reference->GetType() != FourCC( "iloc" ) )
+                {
+                    continue;
+                }
+                
+                for( uint32_t id: reference->GetToItemIDs() )
+                {
+                    this->_references[ reference->GetFromItemID() ].push_back( id );
+                }
+            }
+        }
+        
+        if( idat != nullptr )
+        {
+            this->_idat = idat->GetDataView();
+        }
+    }
+    
+    void ItemDataReader::IMPL::AddItemRanges( uint32_t itemID, unsigned int depth, std::vector< Range > & ranges ) const
+    {
+        std::shared_ptr< ILOC::Item > item;
+        uint64_t                      offset;
+        uint64_t                      length;
+        uint64_t                      size;
+        
+        /* Items built from other items may reference each other in a loop */
+        if( depth > 16 )
+        {
+            throw std::runtime_error( "Invalid item location - Too many nested items" );
+        }
+        
+        {
+            auto it = this->_items.find( itemID );
+            
+            if( it == this->_items.end() )
+            {
+                throw std::runtime_error( "Item " + std::to_string( itemID ) + " has no location" );
+            }
+            
+            item = it->second;
+        }
+        
+        if( item->GetDataReferenceIndex() != 0 )
+        {
+            throw std::runtime_error( "Unsupported item location - Data is stored in another file" );
+        }
+        
+        for( const auto & extent: item->GetExtents() )
+        {
+            offset = item->GetBaseOffset() + extent->GetOffset();
+            length = extent->GetLength();
+            
+            if( offset < extent->GetOffset() )
+            {
+                throw std::runtime_error( "Invalid item location - Offset is out of bounds" );
+            }
+            
+            if( item->GetConstructionMethod() == 0 )
+            {
+                if( this->_stream == nullptr )
+                {
+                    throw std::runtime_error( "Item data is not available - No stream" );
+                }
+                
+                size = this->_stream->Size();
+                
+                /* A zero length means up to the end of the file */
+                if( offset > size || length > size - offset )
+                {
+                    throw std::runtime_error( "Invalid item location - Extent is out of bounds" );
+                }
+                
+                AddRange( ranges, Source::File, offset, ( length == 0 ) ? size - offset : length );
+            }
+            else if( item->GetConstructionMethod() == 1 )
+            {
+                size = this->_idat.GetSize();
+                
+                if( offset > size || length > size - offset )
+                {
+                    throw std::runtime_error( "Invalid item location - Extent is out of bounds" );
+                }
+                
+                AddRange( ranges, Source::IDAT, offset, ( length == 0 ) ? size - offset : length );
+            }
+            else if( item->GetConstructionMethod() == 2 )
+            {
+                std::vector< Range > from;
+                uint64_t             index;
+                
+                /* The index of the referenced item is 1-based, and absent when there is a single one */
+                index = ( extent->GetIndex() == 0 ) ? 1 : extent->GetIndex();
+                
+                {
+                    auto it = this->_references.find( itemID );
+                    
+                    if( it == this->_references.end() || index > it->second.size() )
+                    {
+                        throw std::runtime_error( "Invalid item location - Missing item reference" );
+                    }
+                    
+                    this->AddItemRanges( it->second[ numeric_cast< size_t >( index - 1 ) ], depth + 1, from );
+                }
+                
+                AddSubRanges( ranges, from, offset, length );
+            }
+            else
+            {
+                throw std::runtime_error( "Unsupported item construction method: " + std::to_string( item->GetConstructionMethod() ) );
+            }
+        }
+    }
+    
+    void ItemDataReader::IMPL::AddRange( std::vector< Range > & ranges, Source source, uint64_t offset, uint64_t length )
+    {
+        if( length == 0 )
+        {
+            return;
+        }
+        
+        /* Contiguous extents are read at once */
+        if( ranges.size() > 0 && ranges.back().GetSource() == source && ranges.back().GetOffset() + ranges.back().GetLength() == offset )
+        {
+            ranges.back() = Range( source, ranges.back().GetOffset(), ranges.back().GetLength() + length );
+            
+            return;
+        }
+        
+        ranges.push_back( Range( source, offset, length ) );
+    }
+    
+    void ItemDataReader::IMPL::AddSubRanges( std::vector< Range > & ranges, const std::vector< Range > & from, uint64_t offset, uint64_t length )
+    {
+        uint64_t size;
+        uint64_t skip;
+        uint64_t n;
+        
+        size = 0;
+        
+        for( const auto & range: from )
+        {
+            size += range.GetLength();
+        }
+        
+        /* A zero length means up to the end of the referenced item */
+        if( offset > size || length > size - offset )
+        {
+            throw std::runtime_error( "Invalid item location - Extent is out of bounds" );
+        }
+        
+        length = ( length == 0 ) ? size - offset : length;
+        skip   = offset;
+        
+        for( const auto & range: from )
+        {
+            if( length == 0 )
+            {
+                break;
+            }
+            
+            if( skip >= range.GetLength() )
+            {
+                skip -= range.GetLength();
+                
+                continue;
+            }
+            
+            n = std::min( range.GetLength() - skip, length );
+            
+            AddRange( ranges, range.GetSource(), range.GetOffset() + skip, n );
+            
+            length -= n;
+            skip    = 0;
+        }
+    }
+}
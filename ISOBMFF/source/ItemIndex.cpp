@@ -0,0 +1,572 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ItemIndex.cpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#include <ISOBMFF/ItemIndex.hpp>
+#include <ISOBMFF/File.hpp>
+#include <ISOBMFF/META.hpp>
+#include <ISOBMFF/IINF.hpp>
+#include <ISOBMFF/IPMA.hpp>
+#include <ISOBMFF/IPCO.hpp>
+#include <ISOBMFF/IREF.hpp>
+#include <ISOBMFF/PITM.hpp>
+#include <ISOBMFF/ContainerBox.hpp>
+#include <ISOBMFF/SingleItemTypeReferenceBox.hpp>
+#include <unordered_map>
+#include <utility>
+#include <stdexcept>
+
+namespace ISOBMFF
+{
+    class ItemIndex::IMPL
+    {
+        public:
+            
+            IMPL();
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            void     Build( const META & meta );
+            uint32_t AddItem( uint32_t itemID );
+            
+            template< typename T >
+            static void Flatten( size_t count, std::vector< std::pair< uint32_t, T > > & pairs, std::vector< uint32_t > & offsets, std::vector< T > & values );
+            
+            std::vector< uint32_t >                      _ids;
+            std::unordered_map< uint32_t, uint32_t >     _indices;
+            std::vector< std::shared_ptr< INFE > >       _infos;
+            std::vector< std::shared_ptr< ILOC::Item > > _locations;
+            
+            /* Values of item i are at [ offsets[ i ], offsets[ i + 1 ] ) */
+            std::vector< uint32_t >                      _propertyOffsets;
+            std::vector< Property >                      _properties;
+            std::vector< uint32_t >                      _referenceOffsets;
+            std::vector< Reference >                     _references;
+            std::vector< uint32_t >                      _referenceToOffsets;
+            std::vector< Reference >                     _referencesTo;
+            
+            uint32_t                                     _primaryItemID;
+    };
+    
+    const uint32_t ItemIndex::NoItem;
+    
+    ItemIndex::Property::Property( uint16_t index, bool essential, std::shared_ptr< Box > box ):
+        _index( index ),
+        _essential( essential ),
+        _box( box )
+    {}
+    
+    uint16_t ItemIndex::Property::GetIndex() const
+    {
+        return this->_index;
+    }
+    
+    bool ItemIndex::Property::IsEssential() const
+    {
+        return this->_essential;
+    }
+    
+    std::shared_ptr< Box > ItemIndex::Property::GetBox() const
+    {
+        return this->_box;
+    }
+    
+    ItemIndex::Reference::Reference( FourCC type, uint32_t itemID ):
+        _type( type ),
+        _itemID( itemID )
+    {}
+    
+    FourCC ItemIndex::Reference::GetType() const
+    {
+        return this->_type;
+    }
+    
+    uint32_t ItemIndex::Reference::GetItemID() const
+    {
+        return this->_itemID;
+    }
+    
+    ItemIndex::ItemIndex():
+        impl( std::make_unique< IMPL >() )
+    {}
+    
+    ItemIndex::ItemIndex( const META & meta ):
+        impl( std::make_unique< IMPL >() )
+    {
+        this->impl->Build( meta );
+    }
+    
+    ItemIndex::ItemIndex( const File & file ):
+        impl( std::make_unique< IMPL >() )
+    {
+        std::shared_ptr< META > meta;
+        
+        meta = file.GetTypedBox< META >( "meta" );
+        
+        if( meta == nullptr )
+        {
+            throw std::runtime_error( "File has no meta box" );
+        }
+        
+        this->impl->Build( *( meta ) );
+    }
+    
+    ItemIndex::ItemIndex( const ItemIndex & o ):
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    ItemIndex::ItemIndex( ItemIndex && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {
+        o.impl = nullptr;
+    }
+    
+    ItemIndex::~ItemIndex()
+    {}
+    
+    ItemIndex & ItemIndex::operator =( ItemIndex o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    void swap( ItemIndex & o1, ItemIndex & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    size_t ItemIndex::GetItemCount() const
+    {
+        return this->impl->_ids.size();
+    }
+    
+    uint32_t ItemIndex::GetIndex( uint32_t itemID ) const
+    {
+        auto it = this->impl->_indices.find( itemID );
+        
+        return ( it == this->impl->_indices.end() ) ? NoItem : it->second;
+    }
+    
+    uint32_t ItemIndex::GetItemID( uint32_t index ) const
+    {
+        if( index >= this->impl->_ids.size() )
+        {
+            throw std::runtime_error( "Invalid item index" );
+        }
+        
+        return this->impl->_ids[ index ];
+    }
+    
+    const std::vector< uint32_t > & ItemIndex::GetItemIDs() const
+    {
+        return this->impl->_ids;
+    }
+    
+    bool ItemIndex::HasItem( uint32_t itemID ) const
+    {
+        return this->GetIndex( itemID ) != NoItem;
+    }
+    
+    uint32_t ItemIndex::GetPrimaryItemID() const
+    {
+        return this->impl->_primaryItemID;
+    }
+    
+    std::shared_ptr< INFE > ItemIndex::GetItemInfo( uint32_t itemID ) const
+    {
+        uint32_t i;
+        
+        i = this->GetIndex( itemID );
+        
+        return ( i == NoItem ) ? nullptr : this->impl->_infos[ i ];
+    }
+    
+    std::string ItemIndex::GetItemType( uint32_t itemID ) const
+    {
+        std::shared_ptr< INFE > infe;
+        
+        infe = this->GetItemInfo( itemID );
+        
+        return ( infe == nullptr ) ? "" : infe->GetItemType();
+    }
+    
+    std::shared_ptr< ILOC::Item > ItemIndex::GetItemLocation( uint32_t itemID ) const
+    {
+        uint32_t i;
+        
+        i = this->GetIndex( itemID );
+        
+        return ( i == NoItem ) ? nullptr : this->impl->_locations[ i ];
+    }
+    
+    std::vector< ItemIndex::Property > ItemIndex::GetProperties( uint32_t itemID ) const
+    {
+        uint32_t i;
+        
+        i = this->GetIndex( itemID );
+        
+        if( i == NoItem )
+        {
+            return {};
+        }
+        
+        return std::vector< Property >
+        (
+            this->impl->_properties.begin() + this->impl->_propertyOffsets[ i ],
+            this->impl->_properties.begin() + this->impl->_propertyOffsets[ i + 1 ]
+        );
+    }
+    
+    std::shared_ptr< Box > ItemIndex::GetProperty( uint32_t itemID, FourCC type ) const
+    {
+        uint32_t i;
+        uint32_t j;
+        
+        i = this->GetIndex( itemID );
+        
+        if( i == NoItem )
+        {
+            return nullptr;
+        }
+        
+        for( j = this->impl->_propertyOffsets[ i ]; j < this->impl->_propertyOffsets[ i + 1 ]; j++ )
+        {
+            if( this->impl->_properties[ j ].GetBox()->GetType() == type )
+            {
+                return this->impl->_properties[ j ].GetBox();
+            }
+        }
+        
+        return nullptr;
+    }
+    
+    std::vector< ItemIndex::Reference > ItemIndex::GetReferences( uint32_t itemID ) const
+    {
+        uint32_t i;
+        
+        i = this->GetIndex( itemID );
+        
+        if( i == NoItem )
+        {
+            return {};
+        }
+        
+        return std::vector< Reference >
+        (
+            this->impl->_references.begin() + this->impl->_referenceOffsets[ i ],
+            this->impl->_references.begin() + this->impl->_referenceOffsets[ i + 1 ]
+        );
+    }
+    
+    std::vector< uint32_t > ItemIndex::GetReferencedItems( uint32_t itemID, FourCC type ) const
+    {
+        std::vector< uint32_t > ids;
+        uint32_t                i;
+        uint32_t                j;
+        
+        i = this->GetIndex( itemID );
+        
+        if( i == NoItem )
+        {
+            return {};
+        }
+        
+        for( j = this->impl->_referenceOffsets[ i ]; j < this->impl->_referenceOffsets[ i + 1 ]; j++ )
+        {
+            if( this->impl->_references[ j ].GetType() == type )
+            {
+                ids.push_back( this->impl->_references[ j ].GetItemID() );
+            }
+        }
+        
+        return ids;
+    }
+    
+    std::vector< ItemIndex::Reference > ItemIndex::GetReferencesTo( uint32_t itemID ) const
+    {
+        uint32_t i;
+        
+        i = this->GetIndex( itemID );
+        
+        if( i == NoItem )
+        {
+            return {};
+        }
+        
+        return std::vector< Reference >
+        (
+            this->impl->_referencesTo.begin() + this->impl->_referenceToOffsets[ i ],
+            this->impl->_referencesTo.begin() + this->impl->_referenceToOffsets[ i + 1 ]
+        );
+    }
+    
+    std::vector< uint32_t > ItemIndex::GetReferencingItems( uint32_t itemID, FourCC type ) const
+    {
+        std::vector< uint32_t > ids;
+        uint32_t                i;
+        uint32_t                j;
+        
+        i = this->GetIndex( itemID );
+        
+        if( i == NoItem )
+        {
+            return {};
+        }
+        
+        for( j = this->impl->_referenceToOffsets[ i ]; j < this->impl->_referenceToOffsets[ i + 1 ]; j++ )
+        {
+            if( this->impl->_referencesTo[ j ].GetType() == type )
+            {
+                ids.push_back( this->impl->_referencesTo[ j ].GetItemID() );
+            }
+        }
+        
+        return ids;
+    }
+    
+    ItemIndex::IMPL::IMPL():
+        _propertyOffsets( 1, 0 ),
+        _referenceOffsets( 1, 0 ),
+        _referenceToOffsets( 1, 0 ),
+        _primaryItemID( 0 )
+    {}
+    
+    ItemIndex::IMPL::IMPL( const IMPL & o ):
+        _ids( o._ids ),
+        _indices( o._indices ),
+        _infos( o._infos ),
+        _locations( o._locations ),
+        _propertyOffsets( o._propertyOffsets ),
+        _properties( o._properties ),
+        _referenceOffsets( o._referenceOffsets ),
+        _references( o._references ),
+        _referenceToOffsets( o._referenceToOffsets ),
+        _referencesTo( o._referencesTo ),
+        _primaryItemID( o._primaryItemID )
+    {}
+    
+    ItemIndex::IMPL::~IMPL()
+    {}
+    
+    uint32_t ItemIndex::IMPL::AddItem( uint32_t itemID )
+    {
+        auto it = this->_indices.find( itemID );
+        
+        if( it != this->_indices.end() )
+        {
+            return it->second;
+        }
+        
+        this->_indices[ itemID ] = static_cast< uint32_t >( this->_ids.size() );
+        
+        this->_ids.push_back( itemID );
+        this->_infos.push_back( nullptr );
+        this->_locations.push_back( nullptr );
+        
+        return static_cast< uint32_t >( this->_ids.size() - 1 );
+    }
+    
+    void ItemIndex::IMPL::Build( const META & meta )
+    {
+        std::shared_ptr< IINF >                          iinf;
+        std::shared_ptr< ILOC >                          iloc;
+        std::shared_ptr< IREF >                          iref;
+        std::shared_ptr< PITM >                          pitm;
+        std::shared_ptr< ContainerBox >                  iprp;
+        std::shared_ptr< IPCO >                          ipco;
+        std::vector< std::shared_ptr< IPMA > >           ipmas;
+        std::vector< std::shared_ptr< Box > >            boxes;
+        std::vector< std::pair< uint32_t, Property > >   properties;
+        std::vector< std::pair< uint32_t, Reference > >  references;
+        std::vector< std::pair< uint32_t, Reference > >  referencesTo;
+        
+        iinf = meta.GetTypedBox< IINF >( "iinf" );
+        iloc = meta.GetTypedBox< ILOC >( "iloc" );
+        iref = meta.GetTypedBox< IREF >( "iref" );
+        pitm = meta.GetTypedBox< PITM >( "pitm" );
+        iprp = meta.GetTypedBox< ContainerBox >( "iprp" );
+        
+        if( iprp != nullptr )
+        {
+            ipco = iprp->GetTypedBox< IPCO >( "ipco" );
+            
+            /* There may be several ipma boxes, with different versions and flags */
+            for( const auto & box: iprp->GetBoxes() )
+            {
+                if( box->GetType() == FourCC( "ipma" ) )
+                {
+                    box->Load();
+                    
+                    if( auto ipma = std::dynamic_pointer_cast< IPMA >( box ) )
+                    {
+                        ipmas.push_back( ipma );
+                    }
+                }
+            }
+        }
+        
+        if( pitm != nullptr )
+        {
+            this->_primaryItemID = pitm->GetItemID();
+            
+            this->AddItem( this->_primaryItemID );
+        }
+        
+        if( iinf != nullptr )
+        {
+            for( const auto & infe: iinf->GetEntries() )
+            {
+                uint32_t i;
+                
+                i = this->AddItem( infe->GetItemID() );
+                
+                if( this->_infos[ i ] == nullptr )
+                {
+                    this->_infos[ i ] = infe;
+                }
+            }
+        }
+        
+        if( iloc != nullptr )
+        {
+            for( const auto & item: iloc->GetItems() )
+            {
+                uint32_t i;
+                
+                i = this->AddItem( item->GetItemID() );
+                
+                if( this->_locations[ i ] == nullptr )
+                {
+                    this->_locations[ i ] = item;
+                }
+            }
+        }
+        
+        if( ipco != nullptr )
+        {
+            boxes = ipco->GetBoxes();
+            
+            for( const auto & box: boxes )
+            {
+                box->Load();
+            }
+        }
+        
+        for( const auto & ipma: ipmas )
+        {
+            for( const auto & entry: ipma->GetEntries() )
+            {
+                uint32_t i;
+                
+                i = this->AddItem( entry->GetItemID() );
+                
+                for( const auto & association: entry->GetAssociations() )
+                {
+                    uint16_t index;
+                    
+                    index = association->GetPropertyIndex();
+                    
+                    /* Index 0 means no property */
+                    if( index == 0 || index > boxes.size() )
+                    {
+                        continue;
+                    }
+                    
+                    properties.push_back( { i, Property( index, association->GetEssential(), boxes[ index - 1 ] ) } );
+                }
+            }
+        }
+        
+        if( iref != nullptr )
+        {
+            for( const auto & box: iref->GetBoxes() )
+            {
+                std::shared_ptr< SingleItemTypeReferenceBox > reference;
+                uint32_t                                      from;
+                
+                box->Load();
+                
+                reference = std::dynamic_pointer_cast< SingleItemTypeReferenceBox >( box );
+                
+                if( reference == nullptr )
+                {
+                    continue;
+                }
+                
+                from = this->AddItem( reference->GetFromItemID() );
+                
+                for( uint32_t id: reference->GetToItemIDs() )
+                {
+                    references.push_back( { from, Reference( reference->GetType(), id ) } );
+                    referencesTo.push_back( { this->AddItem( id ), Reference( reference->GetType(), reference->GetFromItemID() ) } );
+                }
+            }
+        }
+        
+        Flatten( this->_ids.size(), properties,   this->_propertyOffsets,    this->_properties );
+        Flatten( this->_ids.size(), references,   this->_referenceOffsets,   this->_references );
+        Flatten( this->_ids.size(), referencesTo, this->_referenceToOffsets, this->_referencesTo );
+    }
+    
+    template< typename T >
+    void ItemIndex::IMPL::Flatten( size_t count, std::vector< std::pair< uint32_t, T > > & pairs, std::vector< uint32_t > & offsets, std::vector< T > & values )
+    {
+        size_t i;
+        
+        /* Stable, so the values of each item keep their file order */
+        std::stable_sort
+        (
+            pairs.begin(),
+            pairs.end(),
+            []( const std::pair< uint32_t, T > & p1, const std::pair< uint32_t, T > & p2 )
+            {
+                return p1.first < p2.first;
+            }
+        );
+        
+        offsets.assign( count + 1, 0 );
+        values.clear();
+        values.reserve( pairs.size() );
+        
+        for( const auto & p: pairs )
+        {
+            offsets[ p.first + 1 ]++;
+            
+            values.push_back( p.second );
+        }
+        
+        for( i = 0; i < count; i++ )
+        {
+            offsets[ i + 1 ] += offsets[ i ];
+        }
+    }
+}
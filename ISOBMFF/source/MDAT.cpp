@@ -0,0 +1,251 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        MDAT.cpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#include <ISOBMFF/MDAT.hpp>
+#include <ISOBMFF/Parser.hpp>
+#include <ISOBMFF/Utils.hpp>
+#include <ISOBMFF/BinarySliceStream.hpp>
+#include <stdexcept>
+
+namespace ISOBMFF
+{
+    class MDAT::IMPL
+    {
+        public:
+            
+            IMPL();
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            uint64_t                        _dataOffset;
+            uint64_t                        _dataLength;
+            std::shared_ptr< BinaryStream > _stream;
+            DataView                        _data;
+            bool                            _hasData;
+    };
+    
+    MDAT::MDAT():
+        Box( "mdat" ),
+        impl( std::make_unique< IMPL >() )
+    {}
+    
+    MDAT::MDAT( const MDAT & o ):
+        Box( o ),
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    MDAT::MDAT( MDAT && o ) noexcept:
+        Box( std::move( o ) ),
+        impl( std::move( o.impl ) )
+    {
+        o.impl = nullptr;
+    }
+    
+    MDAT::~MDAT()
+    {}
+    
+    MDAT & MDAT::operator =( MDAT o )
+    {
+        Box::operator=( o );
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    void swap( MDAT & o1, MDAT & o2 )
+    {
+        using std::swap;
+        
+        swap( static_cast< Box & >( o1 ), static_cast< Box & >( o2 ) );
+        swap( o1.impl, o2.impl );
+    }
+    
+    void MDAT::ReadData( Parser & parser, BinaryStream & stream )
+    {
+        BinarySliceStream * slice;
+        
+        slice = dynamic_cast< BinarySliceStream * >( &stream );
+        
+        this->impl->_dataOffset = ( slice != nullptr ) ? parser.GetStreamOffset( *( slice ) ) : stream.Tell();
+        this->impl->_dataLength = stream.AvailableBytes();
+        this->impl->_stream     = nullptr;
+        
+        /* Retaining the stream keeps its file open as long as the box */
+        if( parser.HasOption( Parser::Options::SkipMDATData ) == false )
+        {
+            this->impl->_stream = parser.GetStream();
+        }
+        
+        this->impl->_data = DataView();
+        
+        this->impl->_hasData = false;
+        
+        if( this->impl->_stream == nullptr && parser.HasOption( Parser::Options::SkipMDATData ) == false )
+        {
+            this->impl->_data    = stream.ReadView( stream.AvailableBytes() );
+            this->impl->_hasData = true;
+        }
+    }
+    
+    std::vector< std::pair< std::string, std::string > > MDAT::GetDisplayableProperties() const
+    {
+        auto props( Box::GetDisplayableProperties() );
+        
+        props.push_back( { "Data offset", std::to_string( this->GetDataOffset() ) } );
+        props.push_back( { "Data length", std::to_string( this->GetDataLength() ) } );
+        
+        return props;
+    }
+    
+    std::vector< uint8_t > MDAT::GetData() const
+    {
+        if( this->IsDataAvailable() == false )
+        {
+            return {};
+        }
+        
+        return this->GetData( 0, this->GetDataLength() );
+    }
+    
+    std::vector< uint8_t > MDAT::GetData( uint64_t offset, uint64_t length ) const
+    {
+        std::vector< uint8_t > data;
+        
+        this->Load();
+        
+        if( this->IsDataAvailable() == false )
+        {
+            throw std::runtime_error( "MDAT data is not available" );
+        }
+        
+        if( offset > this->impl->_dataLength || length > this->impl->_dataLength - offset )
+        {
+            throw std::runtime_error( "Invalid read - Range is out of bounds" );
+        }
+        
+        if( this->impl->_hasData )
+        {
+            return this->impl->_data.GetSubView( numeric_cast< size_t >( offset ), numeric_cast< size_t >( length ) ).GetVector();
+        }
+        
+        data.resize( numeric_cast< size_t >( length ) );
+        
+        if( length > 0 )
+        {
+            this->impl->_stream->ReadAt( this->impl->_dataOffset + offset, &( data[ 0 ] ), data.size() );
+        }
+        
+        return data;
+    }
+    
+    DataView MDAT::GetDataView() const
+    {
+        if( this->IsDataAvailable() == false )
+        {
+            return {};
+        }
+        
+        return this->GetDataView( 0, this->GetDataLength() );
+    }
+    
+    DataView MDAT::GetDataView( uint64_t offset, uint64_t length ) const
+    {
+        this->Load();
+        
+        if( this->IsDataAvailable() == false )
+        {
+            throw std::runtime_error( "MDAT data is not available" );
+        }
+        
+        if( offset > this->impl->_dataLength || length > this->impl->_dataLength - offset )
+        {
+            throw std::runtime_error( "Invalid read - Range is out of bounds" );
+        }
+        
+        if( this->impl->_hasData )
+        {
+            return this->impl->_data.GetSubView( numeric_cast< size_t >( offset ), numeric_cast< size_t >( length ) );
+        }
+        
+        return this->impl->_stream->ReadViewAt( this->impl->_dataOffset + offset, numeric_cast< size_t >( length ) );
+    }
+    
+    bool MDAT::IsDataAvailable() const
+    {
+        this->Load();
+        
+        return this->impl->_stream != nullptr || this->impl->_hasData;
+    }
+    
+    uint64_t MDAT::GetDataOffset() const
+    {
+        this->Load();
+        
+        return this->impl->_dataOffset;
+    }
+    
+    uint64_t MDAT::GetDataLength() const
+    {
+        this->Load();
+        
+        return this->impl->_dataLength;
+    }
+    
+    void MDAT::SetDataOffset( uint64_t value )
+    {
+        this->Load();
+        
+        this->impl->_dataOffset = value;
+    }
+    
+    void MDAT::SetDataLength( uint64_t value )
+    {
+        this->Load();
+        
+        this->impl->_dataLength = value;
+    }
+    
+    MDAT::IMPL::IMPL():
+        _dataOffset( 0 ),
+        _dataLength( 0 ),
+        _hasData( false )
+    {}
+
+    MDAT::IMPL::IMPL( const IMPL & o ):
+        _dataOffset( o._dataOffset ),
+        _dataLength( o._dataLength ),
+        _stream( o._stream ),
+        _data( o._data ),
+        _hasData( o._hasData )
+    {}
+
+    MDAT::IMPL::~IMPL()
+    {}
+}
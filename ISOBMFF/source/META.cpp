@@ -125,6 +125,8 @@ namespace ISOBMFF
     
     std::vector< std::shared_ptr< Box > > META::GetBoxes() const
     {
+        this->Load();
+        
         return this->impl->_boxes;
     }
     
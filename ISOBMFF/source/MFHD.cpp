@@ -92,11 +92,15 @@ namespace ISOBMFF
 
     uint32_t MFHD::GetSequence_Number()  const
     {
+        this->Load();
+        
         return this->impl->_sequence_number;
     }
 
     void MFHD::SetSequence_Number(uint32_t value)
     {
+        this->Load();
+        
         this->impl->_sequence_number = value;
     }
 
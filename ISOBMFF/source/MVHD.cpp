@@ -94,38 +94,40 @@ namespace ISOBMFF
     {
         FullBox::ReadData( parser, stream );
         
-        if( this->GetVersion() == 1 )
-        {
-            this->SetCreationTime( stream.ReadBigEndianUInt64() );
-            this->SetModificationTime( stream.ReadBigEndianUInt64() );
-            this->SetTimescale( stream.ReadBigEndianUInt32() );
-            this->SetDuration( stream.ReadBigEndianUInt64() );
-        }
-        else
-        {
-            this->SetCreationTime( stream.ReadBigEndianUInt32() );
-            this->SetModificationTime( stream.ReadBigEndianUInt32() );
-            this->SetTimescale( stream.ReadBigEndianUInt32() );
-            this->SetDuration( stream.ReadBigEndianUInt32() );
-        }
-        
-        this->SetRate( stream.ReadBigEndianUInt32() );
-        this->SetVolume( stream.ReadBigEndianUInt16() );
-        
-        this->impl->_reserved1      = stream.ReadBigEndianUInt16();
-        this->impl->_reserved2[ 0 ] = stream.ReadBigEndianUInt32();
-        this->impl->_reserved2[ 1 ] = stream.ReadBigEndianUInt32();
-        
-        this->SetMatrix( stream.ReadMatrix() );
-        
-        this->impl->_predefined[ 0 ] = stream.ReadBigEndianUInt32();
-        this->impl->_predefined[ 1 ] = stream.ReadBigEndianUInt32();
-        this->impl->_predefined[ 2 ] = stream.ReadBigEndianUInt32();
-        this->impl->_predefined[ 3 ] = stream.ReadBigEndianUInt32();
-        this->impl->_predefined[ 4 ] = stream.ReadBigEndianUInt32();
-        this->impl->_predefined[ 5 ] = stream.ReadBigEndianUInt32();
-        
-        this->SetNextTrackID( stream.ReadBigEndianUInt32() );
+        BinaryDataReader::Dispatch
+        (
+            stream,
+            [ & ]( auto & reader )
+            {
+                if( this->GetVersion() == 1 )
+                {
+                    this->SetCreationTime( reader.ReadBigEndianUInt64() );
+                    this->SetModificationTime( reader.ReadBigEndianUInt64() );
+                    this->SetTimescale( reader.ReadBigEndianUInt32() );
+                    this->SetDuration( reader.ReadBigEndianUInt64() );
+                }
+                else
+                {
+                    this->SetCreationTime( reader.ReadBigEndianUInt32() );
+                    this->SetModificationTime( reader.ReadBigEndianUInt32() );
+                    this->SetTimescale( reader.ReadBigEndianUInt32() );
+                    this->SetDuration( reader.ReadBigEndianUInt32() );
+                }
+                
+                this->SetRate( reader.ReadBigEndianUInt32() );
+                this->SetVolume( reader.ReadBigEndianUInt16() );
+                
+                this->impl->_reserved1 = reader.ReadBigEndianUInt16();
+                
+                reader.ReadBigEndianUInt32Array( this->impl->_reserved2, 2 );
+                
+                this->SetMatrix( reader.ReadMatrix() );
+                
+                reader.ReadBigEndianUInt32Array( this->impl->_predefined, 6 );
+                
+                this->SetNextTrackID( reader.ReadBigEndianUInt32() );
+            }
+        );
     }
     
     std::vector< std::pair< std::string, std::string > > MVHD::GetDisplayableProperties() const
@@ -146,81 +148,113 @@ namespace ISOBMFF
     
     uint64_t MVHD::GetCreationTime() const
     {
+        this->Load();
+        
         return this->impl->_creationTime;
     }
     
     uint64_t MVHD::GetModificationTime() const
     {
+        this->Load();
+        
         return this->impl->_modificationTime;
     }
     
     uint32_t MVHD::GetTimescale() const
     {
+        this->Load();
+        
         return this->impl->_timescale;
     }
     
     uint64_t MVHD::GetDuration() const
     {
+        this->Load();
+        
         return this->impl->_duration;
     }
     
     uint32_t MVHD::GetRate() const
     {
+        this->Load();
+        
         return this->impl->_rate;
     }
     
     uint16_t MVHD::GetVolume() const
     {
+        this->Load();
+        
         return this->impl->_volume;
     }
     
     Matrix MVHD::GetMatrix() const
     {
+        this->Load();
+        
         return this->impl->_matrix;
     }
     
     uint32_t MVHD::GetNextTrackID() const
     {
+        this->Load();
+        
         return this->impl->_nextTrackID;
     }
     
     void MVHD::SetCreationTime( uint64_t value )
     {
+        this->Load();
+        
         this->impl->_creationTime = value;
     }
     
     void MVHD::SetModificationTime( uint64_t value )
     {
+        this->Load();
+        
         this->impl->_modificationTime = value;
     }
     
     void MVHD::SetTimescale( uint32_t value )
     {
+        this->Load();
+        
         this->impl->_timescale = value;
     }
     
     void MVHD::SetDuration( uint64_t value )
     {
+        this->Load();
+        
         this->impl->_duration = value;
     }
     
     void MVHD::SetRate( uint32_t value )
     {
+        this->Load();
+        
         this->impl->_rate = value;
     }
     
     void MVHD::SetVolume( uint16_t value )
     {
+        this->Load();
+        
         this->impl->_volume = value;
     }
     
     void MVHD::SetMatrix( const Matrix & value )
     {
+        this->Load();
+        
         this->impl->_matrix = value;
     }
     
     void MVHD::SetNextTrackID( uint32_t value )
     {
+        this->Load();
+        
         this->impl->_nextTrackID = value;
     }
     
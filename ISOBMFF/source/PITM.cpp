@@ -104,11 +104,15 @@ namespace ISOBMFF
     
     uint32_t PITM::GetItemID() const
     {
+        this->Load();
+        
         return this->impl->_itemID;
     }
     
     void PITM::SetItemID( uint32_t value )
     {
+        this->Load();
+        
         this->impl->_itemID = value;
     }
     
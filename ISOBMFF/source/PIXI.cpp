@@ -29,6 +29,7 @@
  */
 
 #include <ISOBMFF/PIXI.hpp>
+#include <ISOBMFF/Parser.hpp>
 #include <ISOBMFF/Utils.hpp>
 
 namespace ISOBMFF
@@ -91,7 +92,7 @@ namespace ISOBMFF
         
         for( i = 0; i < count; i++ )
         {
-            this->AddChannel( std::make_shared< Channel >( stream ) );
+            this->AddChannel( parser.CreateObject< Channel >( stream ) );
         }
     }
     
@@ -119,11 +120,15 @@ namespace ISOBMFF
     
     std::vector< std::shared_ptr< PIXI::Channel > > PIXI::GetChannels() const
     {
+        this->Load();
+        
         return this->impl->_channels;
     }
     
     void PIXI::AddChannel( std::shared_ptr< Channel > array )
     {
+        this->Load();
+        
         this->impl->_channels.push_back( array );
     }
     
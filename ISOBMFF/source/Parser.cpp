@@ -31,6 +31,7 @@
 #include <ISOBMFF/Parser.hpp>
 #include <ISOBMFF/ContainerBox.hpp>
 #include <ISOBMFF/BinaryFileStream.hpp>
+#include <ISOBMFF/BinaryMappedFileStream.hpp>
 #include <ISOBMFF/BinaryDataStream.hpp>
 #include <ISOBMFF/FTYP.hpp>
 #include <ISOBMFF/MVHD.hpp>
@@ -62,9 +63,16 @@
 #include <ISOBMFF/MFHD.hpp>
 #include <ISOBMFF/TFHD.hpp>
 #include <ISOBMFF/TREX.hpp>
+#include <ISOBMFF/MDAT.hpp>
+#include "ParserInternal.hpp"
 #include <map>
+#include <unordered_map>
 #include <stdexcept>
 #include <cstring>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
 
 namespace ISOBMFF
 {
@@ -72,22 +80,227 @@ namespace ISOBMFF
     {
         public:
             
-            IMPL();
+            IMPL( bool registerDefaultBoxes = false );
             IMPL( const IMPL & o );
             ~IMPL();
             
-            void RegisterBox( const std::string & type, const std::function< std::shared_ptr< Box >() > & createBox );
+            static const IMPL & Defaults();
+            
+            using BoxFactory = std::function< std::shared_ptr< Box >( const Parser & ) >;
+            
+            void RegisterBox( const std::string & type, const BoxFactory & createBox );
             void RegisterContainerBox( const std::string & type );
+            void RegisterChildBoxesOffset( FourCC type, uint64_t offset );
             void RegisterDefaultBoxes();
             
-            std::shared_ptr< File >                                            _file;
-            std::string                                                        _path;
-            std::map< std::string, std::function< std::shared_ptr< Box >() > > _types;
-            Parser::StringType                                                 _stringType;
-            uint64_t                                                           _options;
-            std::map< std::string, void * >                                    _info;
+            const BoxFactory * FindBox( FourCC type ) const;
+            bool               SkipsBoxData( const Box & box ) const;
+            const uint64_t   * FindContainerBox( FourCC type ) const;
+            
+            /* Range of path indices parsed by a thread, which others can steal from */
+            class BatchQueue
+            {
+                public:
+                    
+                    BatchQueue();
+                    
+                    std::mutex _mutex;
+                    size_t     _begin;
+                    size_t     _end;
+            };
+            
+            static bool NextBatchIndex( std::vector< BatchQueue > & queues, size_t queue, size_t & index );
+            
+            /* Marks box types registered over a default container type */
+            static const uint64_t NotAContainer = UINT64_MAX;
+            
+            std::shared_ptr< File >                                                 _file;
+            std::string                                                             _path;
+            std::unordered_map< FourCC, BoxFactory >                                _types;
+            std::unordered_map< FourCC, uint64_t >                                  _containers;
+            Parser::StringType                                                      _stringType;
+            uint64_t                                                                _options;
+            std::map< std::string, void * >                                         _info;
+            std::shared_ptr< BinaryStream >                                         _stream;
+            std::weak_ptr< Parser >                                                 _lazyParser;
+            std::vector< std::vector< FourCC > >                                    _pathFilters;
+            std::vector< FourCC >                                                   _boxPath;
+            std::shared_ptr< Arena >                                                _arena;
+            uint64_t                                                                _rootOffset;
+            bool                                                                    _retainBoxes;
+            ParserInternal::BoxBeginHandler                                         _boxBegin;
+            ParserInternal::BoxEndHandler                                           _boxEnd;
     };
     
+    void Parser::ParseMany( const std::vector< std::string > & paths, const Parser & parser, size_t threads, const BatchCallback & callback, bool inputOrder ) noexcept( false )
+    {
+        std::vector< std::thread >                                            workers;
+        std::mutex                                                            mutex;
+        std::condition_variable                                               progress;
+        std::map< size_t, std::pair< std::shared_ptr< File >, std::string > > pending;
+        size_t                                                                next;
+        size_t                                                                window;
+        bool                                                                  ordered;
+        std::exception_ptr                                                    failure;
+        std::atomic< bool >                                                   stop;
+        size_t                                                                i;
+        
+        if( threads == 0 )
+        {
+            threads = std::max< size_t >( std::thread::hardware_concurrency(), 1 );
+        }
+        
+        threads = std::min( threads, paths.size() );
+        next    = 0;
+        stop    = false;
+        ordered = inputOrder && callback != nullptr;
+        window  = threads * 2;
+        
+        if( threads == 0 )
+        {
+            return;
+        }
+        
+        /*
+         * In input order, all threads take files from a single queue, so
+         * the files are parsed roughly in order, and a thread waits before
+         * parsing a file too far ahead of the next one to deliver, so the
+         * pending results stay bounded.
+         */
+        std::vector< IMPL::BatchQueue > queues( ( ordered ) ? 1 : threads );
+        
+        for( i = 0; i < queues.size(); i++ )
+        {
+            queues[ i ]._begin = ( paths.size() * i ) / queues.size();
+            queues[ i ]._end   = ( paths.size() * ( i + 1 ) ) / queues.size();
+        }
+        
+        auto deliver = [ & ]( size_t index, const std::shared_ptr< File > & file, const std::string & error )
+        {
+            std::lock_guard< std::mutex > lock( mutex );
+            
+            if( stop || callback == nullptr )
+            {
+                return;
+            }
+            
+            try
+            {
+                if( inputOrder == false )
+                {
+                    callback( index, file, error );
+                    
+                    return;
+                }
+                
+                pending[ index ] = std::make_pair( file, error );
+                
+                while( pending.size() > 0 && pending.begin()->first == next )
+                {
+                    callback( next, pending.begin()->second.first, pending.begin()->second.second );
+                    pending.erase( pending.begin() );
+                    
+                    next++;
+                }
+            }
+            catch( ... )
+            {
+                failure = std::current_exception();
+                stop    = true;
+                
+                pending.clear();
+            }
+            
+            progress.notify_all();
+        };
+        
+        auto wait = [ & ]( size_t index )
+        {
+            std::unique_lock< std::mutex > lock( mutex );
+            
+            progress.wait( lock, [ & ] { return stop || index < next + window; } );
+        };
+        
+        workers.reserve( threads );
+        
+        try
+        {
+            for( i = 0; i < threads; i++ )
+            {
+                workers.push_back
+                (
+                    std::thread
+                    (
+                        [ &, i ]()
+                        {
+                            Parser worker( parser );
+                            size_t index;
+                            
+                            while( stop == false && IMPL::NextBatchIndex( queues, ( ordered ) ? 0 : i, index ) )
+                            {
+                                if( ordered )
+                                {
+                                    wait( index );
+                                    
+                                    if( stop )
+                                    {
+                                        break;
+                                    }
+                                }
+                                
+                                try
+                                {
+                                    worker.Parse( paths[ index ] );
+                                }
+                                catch( const std::exception & e )
+                                {
+                                    deliver( index, nullptr, e.what() );
+                                    
+                                    continue;
+                                }
+                                catch( ... )
+                                {
+                                    deliver( index, nullptr, "Unknown error" );
+                                    
+                                    continue;
+                                }
+                                
+                                deliver( index, worker.GetFile(), "" );
+                            }
+                        }
+                    )
+                );
+            }
+        }
+        catch( ... )
+        {
+            {
+                std::lock_guard< std::mutex > lock( mutex );
+                
+                stop = true;
+            }
+            
+            progress.notify_all();
+            
+            for( auto & worker: workers )
+            {
+                worker.join();
+            }
+            
+            throw;
+        }
+        
+        for( auto & worker: workers )
+        {
+            worker.join();
+        }
+        
+        if( failure != nullptr )
+        {
+            std::rethrow_exception( failure );
+        }
+    }
+    
     Parser::Parser():
         impl( std::make_unique< IMPL >() )
     {}
@@ -104,6 +317,12 @@ namespace ISOBMFF
         this->Parse( data );
     }
     
+    Parser::Parser( const uint8_t * data, size_t size ):
+        impl( std::make_unique< IMPL >() )
+    {
+        this->Parse( data, size );
+    }
+    
     Parser::Parser( BinaryStream & stream ):
         impl( std::make_unique< IMPL >() )
     {
@@ -144,41 +363,278 @@ namespace ISOBMFF
     
     void Parser::RegisterBox( const std::string & type, const std::function< std::shared_ptr< Box >() > & createBox )
     {
-        this->impl->RegisterBox( type, createBox );
+        if( createBox == nullptr )
+        {
+            this->impl->RegisterBox( type, nullptr );
+        }
+        else
+        {
+            this->impl->RegisterBox( type, [ = ]( const Parser & ) { return createBox(); } );
+        }
+    }
+    
+    bool Parser::IsContainerBox( FourCC type ) const
+    {
+        return this->impl->FindContainerBox( type ) != nullptr;
+    }
+    
+    bool Parser::IsContainerBox( const std::string & type ) const
+    {
+        return type.size() == 4 && this->IsContainerBox( FourCC( type ) );
+    }
+    
+    uint64_t Parser::GetChildBoxesOffset( FourCC type ) const
+    {
+        const uint64_t * offset;
+        
+        offset = this->impl->FindContainerBox( type );
+        
+        return ( offset == nullptr ) ? 0 : *( offset );
+    }
+    
+    uint64_t Parser::GetChildBoxesOffset( const std::string & type ) const
+    {
+        return ( type.size() == 4 ) ? this->GetChildBoxesOffset( FourCC( type ) ) : 0;
+    }
+    
+    std::shared_ptr< Box > Parser::CreateBox( FourCC type ) const
+    {
+        const IMPL::BoxFactory * createBox;
+        
+        createBox = this->impl->FindBox( type );
+        
+        if( createBox != nullptr && *( createBox ) != nullptr )
+        {
+            return ( *( createBox ) )( *( this ) );
+        }
+        
+        return this->CreateObject< Box >( type.GetString() );
     }
     
     std::shared_ptr< Box > Parser::CreateBox( const std::string & type ) const
     {
-        for( const auto & p: this->impl->_types )
+        if( type.size() != 4 )
         {
-            if( p.first == type && p.second != nullptr )
+            return this->CreateObject< Box >( type );
+        }
+        
+        return this->CreateBox( FourCC( type ) );
+    }
+    
+    std::shared_ptr< BinaryStream > Parser::GetStream() const
+    {
+        return this->impl->_stream;
+    }
+    
+    uint64_t Parser::GetStreamOffset( const BinarySliceStream & stream ) const
+    {
+        return stream.GetOffset() - this->impl->_rootOffset;
+    }
+    
+    std::shared_ptr< Arena > Parser::GetArena() const
+    {
+        return this->impl->_arena;
+    }
+    
+    void ParserInternal::ReadBoxData( Parser & parser, const std::shared_ptr< Box > & box, BinarySliceStream & stream, uint64_t headerSize )
+    {
+        std::shared_ptr< Parser >       decoder;
+        std::shared_ptr< BinaryStream > root;
+        uint64_t                        offset;
+        uint64_t                        length;
+        std::vector< FourCC >           path;
+        bool                            read;
+        
+        decoder = parser.impl->_lazyParser.lock();
+        read    = parser.impl->SkipsBoxData( *( box ) ) == false;
+        
+        if( parser.impl->_boxBegin != nullptr )
+        {
+            offset = stream.GetOffset() - parser.impl->_rootOffset - headerSize;
+            
+            if( parser.impl->_boxBegin( box, offset, stream.GetLength() + headerSize, headerSize ) == false )
+            {
+                read = false;
+            }
+        }
+        
+        if( read == false )
+        {
+            if( parser.impl->_boxEnd != nullptr )
+            {
+                parser.impl->_boxEnd( box );
+            }
+            
+            return;
+        }
+        
+        parser.impl->_boxPath.push_back( box->GetType() );
+        
+        /*
+         * FTYP sets the string type used by the following boxes, and boxes
+         * read while contextual info is set depend on it, so both are read
+         * immediately.
+         */
+        if( decoder == nullptr || parser.impl->_info.empty() == false || box->GetType() == FourCC( "ftyp" ) )
+        {
+            try
+            {
+                box->ReadData( parser, stream );
+            }
+            catch( ... )
+            {
+                parser.impl->_boxPath.pop_back();
+                
+                throw;
+            }
+            
+            parser.impl->_boxPath.pop_back();
+            
+            if( parser.impl->_boxEnd != nullptr )
             {
-                return p.second();
+                parser.impl->_boxEnd( box );
             }
+            
+            return;
         }
         
-        return std::make_shared< Box >( type );
+        root   = parser.impl->_stream;
+        offset = stream.GetOffset() - parser.impl->_rootOffset;
+        length = stream.GetLength();
+        path   = parser.impl->_boxPath;
+        
+        parser.impl->_boxPath.pop_back();
+        
+        decoder->impl->_stringType = parser.impl->_stringType;
+        
+        box->SetLazyData
+        (
+            [ = ]( Box & b )
+            {
+                BinarySliceStream          content( *( root ), offset, length );
+                std::vector< FourCC >      current;
+                
+                /* Path filters apply relative to the box path */
+                current                 = std::move( decoder->impl->_boxPath );
+                decoder->impl->_boxPath = path;
+                
+                try
+                {
+                    b.ReadData( *( decoder ), content );
+                }
+                catch( ... )
+                {
+                    decoder->impl->_boxPath = std::move( current );
+                    
+                    throw;
+                }
+                
+                decoder->impl->_boxPath = std::move( current );
+            }
+        );
+        
+        if( parser.impl->_boxEnd != nullptr )
+        {
+            parser.impl->_boxEnd( box );
+        }
     }
     
-    void Parser::Parse( const std::string & path ) noexcept( false )
+    void ParserInternal::SetBoxHandlers( Parser & parser, const BoxBeginHandler & begin, const BoxEndHandler & end )
+    {
+        parser.impl->_boxBegin = begin;
+        parser.impl->_boxEnd   = end;
+    }
+    
+    void ParserInternal::SetRetainsBoxes( Parser & parser, bool value )
+    {
+        parser.impl->_retainBoxes = value;
+    }
+    
+    bool Parser::IsRegisteredBox( FourCC type ) const
     {
-        BinaryFileStream stream( path );
+        const IMPL::BoxFactory * createBox;
         
-        this->Parse( stream );
+        createBox = this->impl->FindBox( type );
+        
+        return createBox != nullptr && *( createBox ) != nullptr;
+    }
+    
+    bool Parser::IsRegisteredBox( const std::string & type ) const
+    {
+        return type.size() == 4 && this->IsRegisteredBox( FourCC( type ) );
+    }
+    
+    bool ParserInternal::ShouldReadBox( const Parser & parser, FourCC type )
+    {
+        const std::vector< FourCC > & path  = parser.impl->_boxPath;
+        size_t                        depth = path.size();
+        
+        if( parser.impl->_pathFilters.size() == 0 || ( depth == 0 && type == FourCC( "ftyp" ) ) )
+        {
+            return true;
+        }
+        
+        for( const auto & filter: parser.impl->_pathFilters )
+        {
+            size_t i;
+            
+            for( i = 0; i < depth && i < filter.size() && filter[ i ] == path[ i ]; i++ )
+            {}
+            
+            /* Contained in a selected path */
+            if( i == filter.size() )
+            {
+                return true;
+            }
+            
+            /* Leading to a selected path */
+            if( i == depth && filter[ depth ] == type )
+            {
+                return true;
+            }
+        }
+        
+        return false;
+    }
+    
+    void Parser::Parse( const std::string & path ) noexcept( false )
+    {
+        if( this->HasOption( Options::UseMemoryMappedFiles ) )
+        {
+            this->Parse( std::make_shared< BinaryMappedFileStream >( path ) );
+        }
+        else
+        {
+            this->Parse( std::make_shared< BinaryFileStream >( path ) );
+        }
         
         this->impl->_path = path;
     }
     
     void Parser::Parse( const std::vector< uint8_t > & data ) noexcept( false )
     {
-        BinaryDataStream stream( data );
-        
-        this->Parse( stream );
+        this->Parse( data.data(), data.size() );
+    }
+    
+    void Parser::Parse( const uint8_t * data, size_t size ) noexcept( false )
+    {
+        /* Boxes loaded later retain the stream, but not the data */
+        if( this->HasOption( Options::LazyParsing ) )
+        {
+            this->Parse( std::make_shared< BinaryDataStream >( data, size ) );
+        }
+        else
+        {
+            BinaryDataStream stream( data, size );
+            
+            this->Parse( stream );
+        }
     }
     
     void Parser::Parse( BinaryStream & stream ) noexcept( false )
     {
-        char n[ 4 ] = { 0, 0, 0, 0 };
+        char                      n[ 4 ] = { 0, 0, 0, 0 };
+        std::shared_ptr< Parser > decoder;
         
         if( stream.HasBytesAvailable() == false )
         {
@@ -208,15 +664,137 @@ namespace ISOBMFF
             throw std::runtime_error( std::string( "Data is not an ISO media file" ) );
         }
         
-        this->impl->_path = "";
-        this->impl->_file = std::make_shared< File >();
+        this->impl->_path       = "";
+        this->impl->_arena      = ( this->HasOption( Options::UseArena ) ) ? std::make_shared< Arena >() : nullptr;
+        this->impl->_file       = this->CreateObject< File >();
+        this->impl->_rootOffset = 0;
+        
+        if( auto slice = dynamic_cast< BinarySliceStream * >( &stream ) )
+        {
+            this->impl->_rootOffset = slice->GetOffset();
+        }
+        
+        if( this->HasOption( Options::LazyParsing ) )
+        {
+            if( this->impl->_stream.get() != &stream )
+            {
+                this->impl->_stream = std::shared_ptr< BinaryStream >( &stream, []( BinaryStream * ) {} );
+            }
+            
+            /* Boxes are loaded by a copy of the parser, which they retain */
+            decoder                    = std::make_shared< Parser >( *( this ) );
+            decoder->impl->_file       = nullptr;
+            decoder->impl->_stream     = this->impl->_stream;
+            decoder->impl->_lazyParser = decoder;
+            decoder->impl->_arena      = this->impl->_arena;
+            decoder->impl->_rootOffset = this->impl->_rootOffset;
+            this->impl->_lazyParser    = decoder;
+        }
+        
+        try
+        {
+            if( stream.HasBytesAvailable() )
+            {
+                this->impl->_file->ReadData( *( this ), stream );
+            }
+        }
+        catch( ... )
+        {
+            this->impl->_stream = nullptr;
+            this->impl->_arena  = nullptr;
+            this->impl->_lazyParser.reset();
+            
+            throw;
+        }
+        
+        /* Boxes retain the arena they were allocated from */
+        this->impl->_stream = nullptr;
+        this->impl->_arena  = nullptr;
+        this->impl->_lazyParser.reset();
+    }
+    
+    void Parser::Parse( const std::shared_ptr< BinaryStream > & stream ) noexcept( false )
+    {
+        if( stream == nullptr )
+        {
+            throw std::runtime_error( "Invalid stream" );
+        }
         
-        if( stream.HasBytesAvailable() )
+        this->impl->_stream = stream;
+        
+        try
         {
-            this->impl->_file->ReadData( *( this ), stream );
+            this->Parse( *( stream ) );
+        }
+        catch( ... )
+        {
+            this->impl->_stream = nullptr;
+            
+            throw;
         }
     }
     
+    void Parser::Visit( const std::string & path, BoxVisitor & visitor ) noexcept( false )
+    {
+        if( this->HasOption( Options::UseMemoryMappedFiles ) )
+        {
+            BinaryMappedFileStream stream( path );
+            
+            this->Visit( stream, visitor );
+        }
+        else
+        {
+            BinaryFileStream stream( path );
+            
+            this->Visit( stream, visitor );
+        }
+    }
+    
+    void Parser::Visit( BinaryStream & stream, BoxVisitor & visitor ) noexcept( false )
+    {
+        Parser              decoder( *( this ) );
+        std::vector< bool > read;
+        
+        decoder.RemoveOption( Options::LazyParsing );
+        decoder.AddOption( Options::SkipMDATData );
+        ParserInternal::SetRetainsBoxes( decoder, false );
+        ParserInternal::SetBoxHandlers
+        (
+            decoder,
+            [ & ]( const std::shared_ptr< Box > & box, uint64_t offset, uint64_t size, uint64_t ) -> bool
+            {
+                uint32_t depth;
+                
+                depth = static_cast< uint32_t >( decoder.impl->_boxPath.size() );
+                
+                read.push_back( visitor.OnBoxBegin( box->GetType(), offset, size, depth ) && decoder.IsRegisteredBox( box->GetType() ) );
+                
+                return read.back();
+            },
+            [ & ]( const std::shared_ptr< Box > & box )
+            {
+                uint32_t depth;
+                
+                depth = static_cast< uint32_t >( decoder.impl->_boxPath.size() );
+                
+                if( read.back() && decoder.impl->SkipsBoxData( *( box ) ) == false )
+                {
+                    visitor.OnBox( *( box ) );
+                }
+                
+                read.pop_back();
+                visitor.OnBoxEnd( box->GetType(), depth );
+            }
+        );
+        
+        decoder.Parse( stream );
+    }
+    
+    bool ParserInternal::RetainsBoxes( const Parser & parser )
+    {
+        return parser.impl->_retainBoxes;
+    }
+    
     std::shared_ptr< File > Parser::GetFile() const
     {
         return this->impl->_file;
@@ -257,6 +835,62 @@ namespace ISOBMFF
         return ( this->GetOptions() & static_cast< uint64_t >( option ) ) != 0;
     }
     
+    std::vector< std::string > Parser::GetPathFilters() const
+    {
+        std::vector< std::string > paths;
+        
+        for( const auto & filter: this->impl->_pathFilters )
+        {
+            std::string path;
+            
+            for( const auto & type: filter )
+            {
+                path += ( path.length() > 0 ) ? "/" + type.GetString() : type.GetString();
+            }
+            
+            paths.push_back( path );
+        }
+        
+        return paths;
+    }
+    
+    void Parser::SetPathFilters( const std::vector< std::string > & paths )
+    {
+        this->impl->_pathFilters.clear();
+        
+        for( const auto & path: paths )
+        {
+            this->AddPathFilter( path );
+        }
+    }
+    
+    void Parser::AddPathFilter( const std::string & path )
+    {
+        std::vector< FourCC > filter;
+        size_t                start;
+        size_t                end;
+        
+        for( start = 0; start <= path.length(); start = end + 1 )
+        {
+            end = path.find( '/', start );
+            
+            if( end == std::string::npos )
+            {
+                end = path.length();
+            }
+            
+            if( end > start )
+            {
+                filter.push_back( FourCC( path.substr( start, end - start ) ) );
+            }
+        }
+        
+        if( filter.size() > 0 )
+        {
+            this->impl->_pathFilters.push_back( filter );
+        }
+    }
+    
     const void * Parser::GetInfo( const std::string & key )
     {
         if( this->impl->_info.find( key ) == this->impl->_info.end() )
@@ -279,47 +913,166 @@ namespace ISOBMFF
         }
     }
     
-    Parser::IMPL::IMPL():
+    Parser::IMPL::IMPL( bool registerDefaultBoxes ):
         _stringType( Parser::StringType::NULLTerminated ),
-        _options( 0 )
+        _options( 0 ),
+        _rootOffset( 0 ),
+        _retainBoxes( true )
     {
-        this->RegisterDefaultBoxes();
+        if( registerDefaultBoxes )
+        {
+            this->RegisterDefaultBoxes();
+        }
     }
 
     Parser::IMPL::IMPL( const IMPL & o ):
         _file( o._file ),
         _path( o._path ),
         _types( o._types ),
+        _containers( o._containers ),
         _stringType( o._stringType ),
         _options( o._options ),
-        _info( o._info )
-    {
-        this->RegisterDefaultBoxes();
-    }
+        _info( o._info ),
+        _pathFilters( o._pathFilters ),
+        _rootOffset( 0 ),
+        _retainBoxes( o._retainBoxes )
+    {}
 
     Parser::IMPL::~IMPL()
     {}
+    
+    Parser::IMPL::BatchQueue::BatchQueue():
+        _begin( 0 ),
+        _end( 0 )
+    {}
+    
+    bool Parser::IMPL::NextBatchIndex( std::vector< BatchQueue > & queues, size_t queue, size_t & index )
+    {
+        size_t i;
+        size_t begin;
+        size_t end;
+        
+        for( i = 0; i < queues.size(); i++ )
+        {
+            BatchQueue & victim = queues[ ( queue + i ) % queues.size() ];
+            
+            {
+                std::lock_guard< std::mutex > lock( victim._mutex );
+                
+                if( victim._begin == victim._end )
+                {
+                    continue;
+                }
+                
+                if( i == 0 )
+                {
+                    index = victim._begin++;
+                    
+                    return true;
+                }
+                
+                /* Steals the last half of the remaining paths */
+                begin          = victim._end - ( victim._end - victim._begin + 1 ) / 2;
+                end            = victim._end;
+                victim._end    = begin;
+            }
+            
+            {
+                std::lock_guard< std::mutex > lock( queues[ queue ]._mutex );
+                
+                queues[ queue ]._begin = begin + 1;
+                queues[ queue ]._end   = end;
+            }
+            
+            index = begin;
+            
+            return true;
+        }
+        
+        return false;
+    }
+    
+    /* MDAT boxes only record the range of their data, and are always read */
+    bool Parser::IMPL::SkipsBoxData( const Box & box ) const
+    {
+        return box.GetType() == FourCC( "mdat" )
+            && ( this->_options & static_cast< uint64_t >( Options::SkipMDATData ) ) != 0
+            && dynamic_cast< const MDAT * >( &box ) == nullptr;
+    }
+    
+    /*
+     * The default box types are registered once, and shared by all parsers.
+     * Each parser only stores the box types registered on it.
+     */
+    const Parser::IMPL & Parser::IMPL::Defaults()
+    {
+        static const IMPL defaults( true );
+        
+        return defaults;
+    }
+    
+    const Parser::IMPL::BoxFactory * Parser::IMPL::FindBox( FourCC type ) const
+    {
+        auto it( this->_types.find( type ) );
+        
+        if( it != this->_types.end() )
+        {
+            return &( it->second );
+        }
+        
+        if( this == &Defaults() )
+        {
+            return nullptr;
+        }
+        
+        return Defaults().FindBox( type );
+    }
+    
+    const uint64_t * Parser::IMPL::FindContainerBox( FourCC type ) const
+    {
+        auto it( this->_containers.find( type ) );
+        
+        if( it != this->_containers.end() )
+        {
+            return ( it->second == NotAContainer ) ? nullptr : &( it->second );
+        }
+        
+        if( this == &Defaults() )
+        {
+            return nullptr;
+        }
+        
+        return Defaults().FindContainerBox( type );
+    }
 
-    void Parser::IMPL::RegisterBox( const std::string & type, const std::function< std::shared_ptr< Box >() > & createBox )
+    void Parser::IMPL::RegisterBox( const std::string & type, const BoxFactory & createBox )
     {
         if( type.size() != 4 )
         {
             throw std::runtime_error( "Box name should be 4 characters long" );
         }
         
-        this->_types[ type ] = createBox;
+        this->_types[ FourCC( type ) ]      = createBox;
+        this->_containers[ FourCC( type ) ] = NotAContainer;
     }
 
     void Parser::IMPL::RegisterContainerBox( const std::string & type )
     {
-        return this->RegisterBox
+        this->RegisterBox
         (
             type,
-            [ = ]() -> std::shared_ptr< Box >
+            [ = ]( const Parser & parser ) -> std::shared_ptr< Box >
             {
-                return std::make_shared< ContainerBox >( type );
+                return parser.CreateObject< ContainerBox >( type );
             }
         );
+        
+        this->RegisterChildBoxesOffset( FourCC( type ), 0 );
+    }
+    
+    void Parser::IMPL::RegisterChildBoxesOffset( FourCC type, uint64_t offset )
+    {
+        this->_containers[ type ] = offset;
     }
 
     void Parser::IMPL::RegisterDefaultBoxes()
@@ -346,36 +1099,44 @@ namespace ISOBMFF
         this->RegisterContainerBox( "tapt" );
         this->RegisterContainerBox( "schi" );
         
-        this->RegisterBox( "ftyp", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< FTYP >(); } );
-        this->RegisterBox( "mvhd", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< MVHD >(); } );
-        this->RegisterBox( "tkhd", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< TKHD >(); } );
-        this->RegisterBox( "meta", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< META >(); } );
-        this->RegisterBox( "hdlr", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< HDLR >(); } );
-        this->RegisterBox( "pitm", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< PITM >(); } );
-        this->RegisterBox( "iinf", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< IINF >(); } );
-        this->RegisterBox( "dref", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< DREF >(); } );
-        this->RegisterBox( "url ", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< URL  >(); } );
-        this->RegisterBox( "urn ", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< URN  >(); } );
-        this->RegisterBox( "iloc", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< ILOC >(); } );
-        this->RegisterBox( "iref", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< IREF >(); } );
-        this->RegisterBox( "infe", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< INFE >(); } );
-        this->RegisterBox( "irot", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< IROT >(); } );
-        this->RegisterBox( "hvcC", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< HVCC >(); } );
-        this->RegisterBox( "dimg", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< DIMG >(); } );
-        this->RegisterBox( "thmb", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< THMB >(); } );
-        this->RegisterBox( "cdsc", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< CDSC >(); } );
-        this->RegisterBox( "colr", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< COLR >(); } );
-        this->RegisterBox( "ispe", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< ISPE >(); } );
-        this->RegisterBox( "ipma", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< IPMA >(); } );
-        this->RegisterBox( "pixi", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< PIXI >(); } );
-        this->RegisterBox( "ipco", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< IPCO >(); } );
-        this->RegisterBox( "stsd", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< STSD >(); } );
-        this->RegisterBox( "frma", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< FRMA >(); } );
-        this->RegisterBox( "schm", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< SCHM >(); } );
+        this->RegisterBox( "ftyp", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< FTYP >(); } );
+        this->RegisterBox( "mvhd", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< MVHD >(); } );
+        this->RegisterBox( "tkhd", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< TKHD >(); } );
+        this->RegisterBox( "meta", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< META >(); } );
+        this->RegisterBox( "hdlr", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< HDLR >(); } );
+        this->RegisterBox( "pitm", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< PITM >(); } );
+        this->RegisterBox( "iinf", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< IINF >(); } );
+        this->RegisterBox( "dref", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< DREF >(); } );
+        this->RegisterBox( "url ", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< URL  >(); } );
+        this->RegisterBox( "urn ", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< URN  >(); } );
+        this->RegisterBox( "iloc", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< ILOC >(); } );
+        this->RegisterBox( "iref", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< IREF >(); } );
+        this->RegisterBox( "infe", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< INFE >(); } );
+        this->RegisterBox( "irot", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< IROT >(); } );
+        this->RegisterBox( "hvcC", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< HVCC >(); } );
+        this->RegisterBox( "dimg", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< DIMG >(); } );
+        this->RegisterBox( "thmb", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< THMB >(); } );
+        this->RegisterBox( "cdsc", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< CDSC >(); } );
+        this->RegisterBox( "colr", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< COLR >(); } );
+        this->RegisterBox( "ispe", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< ISPE >(); } );
+        this->RegisterBox( "ipma", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< IPMA >(); } );
+        this->RegisterBox( "pixi", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< PIXI >(); } );
+        this->RegisterBox( "ipco", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< IPCO >(); } );
+        this->RegisterBox( "stsd", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< STSD >(); } );
+        this->RegisterBox( "frma", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< FRMA >(); } );
+        this->RegisterBox( "schm", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< SCHM >(); } );
 
-        this->RegisterBox( "sidx", [ = ]() -> std::shared_ptr< Box > { return std::make_shared< SIDX >(); } );
-        this->RegisterBox( "mfhd", [=]() -> std::shared_ptr< Box > { return std::make_shared< MFHD >(); });
-        this->RegisterBox("tfhd", [=]() -> std::shared_ptr< Box > { return std::make_shared< TFHD >(); });
-        this->RegisterBox("trex", [=]() -> std::shared_ptr< Box > { return std::make_shared< TREX >(); });
+        this->RegisterBox( "sidx", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< SIDX >(); } );
+        this->RegisterBox( "mfhd", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< MFHD >(); } );
+        this->RegisterBox( "tfhd", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< TFHD >(); } );
+        this->RegisterBox( "trex", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< TREX >(); } );
+        this->RegisterBox( "mdat", []( const Parser & parser ) -> std::shared_ptr< Box > { return parser.CreateObject< MDAT >(); } );
+        
+        this->RegisterChildBoxesOffset( FourCC( "meta" ), 4 );
+        this->RegisterChildBoxesOffset( FourCC( "iinf" ), 6 );
+        this->RegisterChildBoxesOffset( FourCC( "iref" ), 4 );
+        this->RegisterChildBoxesOffset( FourCC( "dref" ), 8 );
+        this->RegisterChildBoxesOffset( FourCC( "stsd" ), 8 );
+        this->RegisterChildBoxesOffset( FourCC( "ipco" ), 0 );
     }
 }
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ParserInternal.hpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#ifndef ISOBMFF_PARSER_INTERNAL_HPP
+#define ISOBMFF_PARSER_INTERNAL_HPP
+
+#include <ISOBMFF/Parser.hpp>
+#include <ISOBMFF/Box.hpp>
+#include <ISOBMFF/BinarySliceStream.hpp>
+#include <ISOBMFF/FourCC.hpp>
+#include <functional>
+#include <memory>
+#include <cstdint>
+
+namespace ISOBMFF
+{
+    /*!
+     * @class       ParserInternal
+     * @abstract    Parser hooks used by the library's boxes and parsers.
+     * @discussion  Not part of the public API, and not installed with the
+     *              public headers.
+     */
+    class ParserInternal
+    {
+        public:
+            
+            /* Called with the box, its offset, size and header size, returns false to skip its data */
+            using BoxBeginHandler = std::function< bool( const std::shared_ptr< Box > &, uint64_t, uint64_t, uint64_t ) >;
+            
+            /* Called once the box data has been read */
+            using BoxEndHandler = std::function< void( const std::shared_ptr< Box > & ) >;
+            
+            /*!
+             * @function    ReadBoxData
+             * @abstract    Reads the data of a box found while parsing.
+             * @param       parser      The parser currently being used.
+             * @param       box         The box.
+             * @param       stream      The slice of the parsed stream containing the box data.
+             * @param       headerSize  The size of the box header, preceding the data.
+             * @discussion  If the LazyParsing option is set, reading the data
+             *              is deferred until the box is loaded. The data of
+             *              MDAT boxes is not read if the SkipMDATData option
+             *              is set.
+             * @see         Box::Load
+             */
+            static void ReadBoxData( Parser & parser, const std::shared_ptr< Box > & box, BinarySliceStream & stream, uint64_t headerSize );
+            
+            /*!
+             * @function    ShouldReadBox
+             * @abstract    Checks if a box found while parsing needs to be read.
+             * @param       parser  The parser currently being used.
+             * @param       type    The box type.
+             * @result      true if the box path, relative to the box currently
+             *              being read, is selected by the path filters,
+             *              otherwise false.
+             * @see         Parser::SetPathFilters
+             */
+            static bool ShouldReadBox( const Parser & parser, FourCC type );
+            
+            /*!
+             * @function    RetainsBoxes
+             * @abstract    Checks if parsed boxes are added to their container.
+             * @param       parser  The parser currently being used.
+             * @result      true when parsing, false when visiting a file or
+             *              building a flat file.
+             */
+            static bool RetainsBoxes( const Parser & parser );
+            
+            /*!
+             * @function    SetRetainsBoxes
+             * @abstract    Sets whether parsed boxes are added to their container.
+             * @param       parser  The parser.
+             * @param       value   false to release each box once read.
+             */
+            static void SetRetainsBoxes( Parser & parser, bool value );
+            
+            /*!
+             * @function    SetBoxHandlers
+             * @abstract    Sets functions called for each box found while parsing.
+             * @param       parser  The parser.
+             * @param       begin   Called before reading a box, or nullptr.
+             * @param       end     Called after reading a box, or nullptr.
+             */
+            static void SetBoxHandlers( Parser & parser, const BoxBeginHandler & begin, const BoxEndHandler & end );
+    };
+}
+
+#endif /* ISOBMFF_PARSER_INTERNAL_HPP */
@@ -87,20 +87,27 @@ namespace ISOBMFF
     {
         FullBox::ReadData( parser, stream );
         
-        this->SetSchemeType( stream.ReadFourCC() );
-        this->SetSchemeVersion( stream.ReadBigEndianUInt32() );
-        
-        if( this->GetFlags() & 0x000001 )
-        {
-            if( parser.GetPreferredStringType() == Parser::StringType::Pascal )
-            {
-                this->SetSchemeURI( stream.ReadPascalString() );
-            }
-            else
+        BinaryDataReader::Dispatch
+        (
+            stream,
+            [ & ]( auto & reader )
             {
-                this->SetSchemeURI( stream.ReadNULLTerminatedString() );
+                this->SetSchemeType( reader.ReadFourCC() );
+                this->SetSchemeVersion( reader.ReadBigEndianUInt32() );
+                
+                if( this->GetFlags() & 0x000001 )
+                {
+                    if( parser.GetPreferredStringType() == Parser::StringType::Pascal )
+                    {
+                        this->SetSchemeURI( reader.ReadPascalString() );
+                    }
+                    else
+                    {
+                        this->SetSchemeURI( reader.ReadNULLTerminatedString() );
+                    }
+                }
             }
-        }
+        );
     }
     
     std::vector< std::pair< std::string, std::string > > SCHM::GetDisplayableProperties() const
@@ -116,31 +123,43 @@ namespace ISOBMFF
     
     std::string SCHM::GetSchemeType() const
     {
+        this->Load();
+        
         return this->impl->_schemeType;
     }
     
     uint32_t SCHM::GetSchemeVersion() const
     {
+        this->Load();
+        
         return this->impl->_schemeVersion;
     }
     
     std::string SCHM::GetSchemeURI() const
     {
+        this->Load();
+        
         return this->impl->_schemeURI;
     }
     
     void SCHM::SetSchemeType( const std::string & value )
     {
+        this->Load();
+        
         this->impl->_schemeType = value;
     }
     
     void SCHM::SetSchemeVersion( uint32_t value )
     {
+        this->Load();
+        
         this->impl->_schemeVersion = value;
     }
     
     void SCHM::SetSchemeURI( const std::string & value )
     {
+        this->Load();
+        
         this->impl->_schemeURI = value;
     }
     
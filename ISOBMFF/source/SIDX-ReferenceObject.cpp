@@ -55,14 +55,30 @@ namespace ISOBMFF
     SIDX::ReferenceObject::ReferenceObject( BinaryStream & stream ):
         impl( std::make_unique< IMPL >() )
     {
-        auto vf = stream.ReadBigEndianUInt32();
+        this->Read( stream );
+    }
+    
+    SIDX::ReferenceObject::ReferenceObject( BinaryDataReader & stream ):
+        impl( std::make_unique< IMPL >() )
+    {
+        this->Read( stream );
+    }
+    
+    template< typename T >
+    void SIDX::ReferenceObject::Read( T & stream )
+    {
+        uint32_t v[ 3 ];
+
+        stream.ReadBigEndianUInt32Array(v, 3);
+
+        auto vf = v[ 0 ];
 
         this->SetReferenceType(static_cast<bool>(vf >> 31));
         this->SetReference_Size(static_cast<uint32_t>(vf & 0x7fffffff));
 
-        this->SetSubsegment_Duration(stream.ReadBigEndianUInt32());
+        this->SetSubsegment_Duration(v[ 1 ]);
 
-        vf = stream.ReadBigEndianUInt32();
+        vf = v[ 2 ];
         this->SetStarts_with_SAP(static_cast<bool>(vf >> 31));
         
         this->SetSAP_Type(static_cast<uint32_t>(vf >> 28 & 0x0fff));
@@ -98,37 +98,48 @@ namespace ISOBMFF
     {
         FullBox::ReadData(parser, stream);
 
-        this->SetReference_ID( stream.ReadBigEndianUInt32() );
-        this->SetTimeScale( stream.ReadBigEndianUInt32() );
-
-        if (this->GetVersion() == 0)
-        {
-            this->SetEarliest_Presentation_Time(stream.ReadBigEndianUInt32());
-            this->SetFirst_Offset(stream.ReadBigEndianUInt32());
-        }
-        else
-        {
-            this->SetEarliest_Presentation_Time(stream.ReadBigEndianUInt64());
-            this->SetFirst_Offset(stream.ReadBigEndianUInt64());
-        }
-
-        auto reserved = stream.ReadBigEndianUInt16();
-        auto reference_count = stream.ReadBigEndianUInt16();
-        this->impl->_reference_count = reference_count;
-
-        for (int i = 0; i < reference_count; i++)
-        {
-            this->AddReferenceObject(std::make_shared< ReferenceObject >(stream));
-        }       
+        BinaryDataReader::Dispatch
+        (
+            stream,
+            [ & ]( auto & reader )
+            {
+                this->SetReference_ID( reader.ReadBigEndianUInt32() );
+                this->SetTimeScale( reader.ReadBigEndianUInt32() );
+
+                if (this->GetVersion() == 0)
+                {
+                    this->SetEarliest_Presentation_Time(reader.ReadBigEndianUInt32());
+                    this->SetFirst_Offset(reader.ReadBigEndianUInt32());
+                }
+                else
+                {
+                    this->SetEarliest_Presentation_Time(reader.ReadBigEndianUInt64());
+                    this->SetFirst_Offset(reader.ReadBigEndianUInt64());
+                }
+
+                auto reserved = reader.ReadBigEndianUInt16();
+                auto reference_count = reader.ReadBigEndianUInt16();
+                this->impl->_reference_count = reference_count;
+
+                for (int i = 0; i < reference_count; i++)
+                {
+                    this->AddReferenceObject(parser.CreateObject< ReferenceObject >(reader));
+                }
+            }
+        );
     }
 
     std::vector< std::shared_ptr< SIDX::ReferenceObject > > SIDX::GetReferenceObjects() const
     {
+        this->Load();
+        
         return this->impl->_referenceObjects;
     }
 
     void SIDX::AddReferenceObject(std::shared_ptr< ReferenceObject > array)
     {
+        this->Load();
+        
         this->impl->_referenceObjects.push_back(array);
     }
     
@@ -166,41 +177,57 @@ namespace ISOBMFF
 
     uint32_t SIDX::GetReference_ID() const
     {
+        this->Load();
+        
         return this->impl->_reference_id;
     }
     
     uint32_t SIDX::GetTimeScale() const
     {
+        this->Load();
+        
         return this->impl->_timescale;
     }
     
     uint64_t SIDX::GetEarliest_Presentation_Time() const
     {
+        this->Load();
+        
         return this->impl->_earliest_presentation_time;
     }
     
     uint64_t SIDX::GetFirst_Offset( ) const
     {
+        this->Load();
+        
         return this->impl->_first_offset;
     }   
 
     void SIDX::SetReference_ID( uint32_t value )
     {
+        this->Load();
+        
         this->impl->_reference_id = value;
     }
     
     void SIDX::SetTimeScale( uint32_t value )
     {
+        this->Load();
+        
         this->impl->_timescale = value;
     }
     
     void SIDX::SetEarliest_Presentation_Time( uint64_t value )
     {
+        this->Load();
+        
         this->impl->_earliest_presentation_time = value;
     }
 
     void SIDX::SetFirst_Offset( uint64_t value )
     {
+        this->Load();
+        
         this->impl->_first_offset = value;
     }
     
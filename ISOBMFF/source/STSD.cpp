@@ -107,6 +107,8 @@ namespace ISOBMFF
     
     std::vector< std::shared_ptr< Box > > STSD::GetBoxes() const
     {
+        this->Load();
+        
         return this->impl->_boxes;
     }
     
@@ -134,21 +134,29 @@ namespace ISOBMFF
     
     uint32_t SingleItemTypeReferenceBox::GetFromItemID() const
     {
+        this->Load();
+        
         return this->impl->_fromItemID;
     }
     
     std::vector< uint32_t > SingleItemTypeReferenceBox::GetToItemIDs() const
     {
+        this->Load();
+        
         return this->impl->_toItemIDs;
     }
     
     void SingleItemTypeReferenceBox::SetFromItemID( uint32_t value )
     {
+        this->Load();
+        
         this->impl->_fromItemID = value;
     }
     
     void SingleItemTypeReferenceBox::AddToItemID( uint32_t value )
     {
+        this->Load();
+        
         this->impl->_toItemIDs.push_back( value );
     }
     
@@ -101,77 +101,108 @@ namespace ISOBMFF
     {
         FullBox::ReadData(parser, stream);
 
-        this->SetTrack_ID( stream.ReadBigEndianUInt32() );
-        auto flags = this->GetFlags();
-        if (flags & MOV_TFHD_BASE_DATA_OFFSET)
-            this->SetBase_Data_Offset(stream.ReadBigEndianUInt64());
-        else
-            this->SetBase_Data_Offset(0);
-        if (flags & MOV_TFHD_STSD_ID)
-            this->SetSample_Description_Index(stream.ReadBigEndianUInt32());
-        else
-            this->SetSample_Description_Index(0);
-        if (flags & MOV_TFHD_DEFAULT_DURATION)
-            this->SetDefault_Sample_Duration(stream.ReadBigEndianUInt32());
-        else
-            this->SetDefault_Sample_Duration(0);
-        if (flags & MOV_TFHD_DEFAULT_SIZE)
-            this->SetDefault_Sample_Size(stream.ReadBigEndianUInt32());
-        else
-            this->SetDefault_Sample_Size(0);
-        if (flags & MOV_TFHD_DEFAULT_FLAGS)
-            this->SetDefault_Sample_Flags(stream.ReadBigEndianUInt32());
-        else
-            this->SetDefault_Sample_Flags(0);
+        BinaryDataReader::Dispatch
+        (
+            stream,
+            [ & ]( auto & reader )
+            {
+                this->SetTrack_ID( reader.ReadBigEndianUInt32() );
+                auto flags = this->GetFlags();
+                if (flags & MOV_TFHD_BASE_DATA_OFFSET)
+                    this->SetBase_Data_Offset(reader.ReadBigEndianUInt64());
+                else
+                    this->SetBase_Data_Offset(0);
+                if (flags & MOV_TFHD_STSD_ID)
+                    this->SetSample_Description_Index(reader.ReadBigEndianUInt32());
+                else
+                    this->SetSample_Description_Index(0);
+                if (flags & MOV_TFHD_DEFAULT_DURATION)
+                    this->SetDefault_Sample_Duration(reader.ReadBigEndianUInt32());
+                else
+                    this->SetDefault_Sample_Duration(0);
+                if (flags & MOV_TFHD_DEFAULT_SIZE)
+                    this->SetDefault_Sample_Size(reader.ReadBigEndianUInt32());
+                else
+                    this->SetDefault_Sample_Size(0);
+                if (flags & MOV_TFHD_DEFAULT_FLAGS)
+                    this->SetDefault_Sample_Flags(reader.ReadBigEndianUInt32());
+                else
+                    this->SetDefault_Sample_Flags(0);
+            }
+        );
     }
 
     uint32_t    TFHD::GetTrack_ID()  const
     {
+        this->Load();
+        
         return this->impl->_track_ID;
     }
     uint64_t    TFHD::GetBase_Data_Offset()  const
     {
+        this->Load();
+        
         return this->impl->_base_data_offset;
     }
     uint32_t    TFHD::GetSample_Description_Index()  const
     {
+        this->Load();
+        
         return this->impl->_sample_description_index;
     }
     uint32_t    TFHD::GetDefault_Sample_Duration()  const
     {
+        this->Load();
+        
         return this->impl->_default_sample_duration;
     }
     uint32_t    TFHD::GetDefault_Sample_Size()  const
     {
+        this->Load();
+        
         return this->impl->_default_sample_size;
     }
     uint32_t    TFHD::GetDefault_Sample_Flags()  const
     {
+        this->Load();
+        
         return this->impl->_default_sample_flags;
     }
 
     void        TFHD::SetTrack_ID(uint32_t value)
     {
+        this->Load();
+        
         this->impl->_track_ID = value;
     }
     void        TFHD::SetBase_Data_Offset(uint64_t value)
     {
+        this->Load();
+        
         this->impl->_base_data_offset = value;
     }
     void        TFHD::SetSample_Description_Index(uint32_t value)
     {
+        this->Load();
+        
         this->impl->_sample_description_index = value;
     }
     void        TFHD::SetDefault_Sample_Duration(uint32_t value)
     {
+        this->Load();
+        
         this->impl->_default_sample_duration = value;
     }
     void        TFHD::SetDefault_Sample_Size(uint32_t value)
     {
+        this->Load();
+        
         this->impl->_default_sample_size = value;
     }
     void        TFHD::SetDefault_Sample_Flags(uint32_t value)
     {
+        this->Load();
+        
         this->impl->_default_sample_flags = value;
     }
 
@@ -96,39 +96,45 @@ namespace ISOBMFF
     {
         FullBox::ReadData( parser, stream );
         
-        if( this->GetVersion() == 1 )
-        {
-            this->SetCreationTime( stream.ReadBigEndianUInt64() );
-            this->SetModificationTime( stream.ReadBigEndianUInt64() );
-            this->SetTrackID( stream.ReadBigEndianUInt32() );
-            
-            this->impl->_reserved1 = stream.ReadBigEndianUInt32();
-            
-            this->SetDuration( stream.ReadBigEndianUInt64() );
-        }
-        else
-        {
-            this->SetCreationTime( stream.ReadBigEndianUInt32() );
-            this->SetModificationTime( stream.ReadBigEndianUInt32() );
-            this->SetTrackID( stream.ReadBigEndianUInt32() );
-            
-            this->impl->_reserved1 = stream.ReadBigEndianUInt32();
-            
-            this->SetDuration( stream.ReadBigEndianUInt32() );
-        }
-        
-        this->impl->_reserved2[ 0 ] = stream.ReadBigEndianUInt32();
-        this->impl->_reserved2[ 1 ] = stream.ReadBigEndianUInt32();
-        
-        this->SetLayer( stream.ReadBigEndianUInt16() );
-        this->SetAlternateGroup( stream.ReadBigEndianUInt16() );
-        this->SetVolume( stream.ReadBigEndianUInt16() );
-        
-        this->impl->_reserved3 = stream.ReadBigEndianUInt16();
-        
-        this->SetMatrix( stream.ReadMatrix() );
-        this->SetWidth( stream.ReadBigEndianFixedPoint( 16, 16 ) );
-        this->SetHeight( stream.ReadBigEndianFixedPoint( 16, 16 ) );
+        BinaryDataReader::Dispatch
+        (
+            stream,
+            [ & ]( auto & reader )
+            {
+                if( this->GetVersion() == 1 )
+                {
+                    this->SetCreationTime( reader.ReadBigEndianUInt64() );
+                    this->SetModificationTime( reader.ReadBigEndianUInt64() );
+                    this->SetTrackID( reader.ReadBigEndianUInt32() );
+                
+                    this->impl->_reserved1 = reader.ReadBigEndianUInt32();
+                
+                    this->SetDuration( reader.ReadBigEndianUInt64() );
+                }
+                else
+                {
+                    this->SetCreationTime( reader.ReadBigEndianUInt32() );
+                    this->SetModificationTime( reader.ReadBigEndianUInt32() );
+                    this->SetTrackID( reader.ReadBigEndianUInt32() );
+                
+                    this->impl->_reserved1 = reader.ReadBigEndianUInt32();
+                
+                    this->SetDuration( reader.ReadBigEndianUInt32() );
+                }
+                
+                reader.ReadBigEndianUInt32Array( this->impl->_reserved2, 2 );
+                
+                this->SetLayer( reader.ReadBigEndianUInt16() );
+                this->SetAlternateGroup( reader.ReadBigEndianUInt16() );
+                this->SetVolume( reader.ReadBigEndianUInt16() );
+                
+                this->impl->_reserved3 = reader.ReadBigEndianUInt16();
+                
+                this->SetMatrix( reader.ReadMatrix() );
+                this->SetWidth( reader.ReadBigEndianFixedPoint( 16, 16 ) );
+                this->SetHeight( reader.ReadBigEndianFixedPoint( 16, 16 ) );
+            }
+        );
     }
     
     std::vector< std::pair< std::string, std::string > > TKHD::GetDisplayableProperties() const
@@ -151,101 +157,141 @@ namespace ISOBMFF
     
     uint64_t TKHD::GetCreationTime() const
     {
+        this->Load();
+        
         return this->impl->_creationTime;
     }
     
     uint64_t TKHD::GetModificationTime() const
     {
+        this->Load();
+        
         return this->impl->_modificationTime;
     }
     
     uint32_t TKHD::GetTrackID() const
     {
+        this->Load();
+        
         return this->impl->_trackID;
     }
     
     uint64_t TKHD::GetDuration() const
     {
+        this->Load();
+        
         return this->impl->_duration;
     }
     
     uint16_t TKHD::GetLayer() const
     {
+        this->Load();
+        
         return this->impl->_layer;
     }
     
     uint16_t TKHD::GetAlternateGroup() const
     {
+        this->Load();
+        
         return this->impl->_alternateGroup;
     }
     
     uint16_t TKHD::GetVolume() const
     {
+        this->Load();
+        
         return this->impl->_volume;
     }
     
     Matrix TKHD::GetMatrix() const
     {
+        this->Load();
+        
         return this->impl->_matrix;
     }
     
     float TKHD::GetWidth() const
     {
+        this->Load();
+        
         return this->impl->_width;
     }
     
     float TKHD::GetHeight() const
     {
+        this->Load();
+        
         return this->impl->_height;
     }
     
     void TKHD::SetCreationTime( uint64_t value )
     {
+        this->Load();
+        
         this->impl->_creationTime = value;
     }
     
     void TKHD::SetModificationTime( uint64_t value )
     {
+        this->Load();
+        
         this->impl->_modificationTime = value;
     }
     
     void TKHD::SetTrackID( uint32_t value )
     {
+        this->Load();
+        
         this->impl->_trackID = value;
     }
     
     void TKHD::SetDuration( uint64_t value )
     {
+        this->Load();
+        
         this->impl->_duration = value;
     }
     
     void TKHD::SetLayer( uint16_t value )
     {
+        this->Load();
+        
         this->impl->_layer = value;
     }
     
     void TKHD::SetAlternateGroup( uint16_t value )
     {
+        this->Load();
+        
         this->impl->_alternateGroup = value;
     }
     
     void TKHD::SetVolume( uint16_t value )
     {
+        this->Load();
+        
         this->impl->_volume = value;
     }
     
     void TKHD::SetMatrix( Matrix value )
     {
+        this->Load();
+        
         this->impl->_matrix = value;
     }
     
     void TKHD::SetWidth( float value )
     {
+        this->Load();
+        
         this->impl->_width = value;
     }
     
     void TKHD::SetHeight( float value )
     {
+        this->Load();
+        
         this->impl->_height = value;
     }
     
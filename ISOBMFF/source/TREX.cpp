@@ -91,52 +91,79 @@ namespace ISOBMFF
     {
         FullBox::ReadData(parser, stream);
 
-        this->SetTrack_ID( stream.ReadBigEndianUInt32() );
-        this->SetDefault_Sample_Description_Index(stream.ReadBigEndianUInt32());
-        this->SetDefault_Sample_Duration(stream.ReadBigEndianUInt32());
-        this->SetDefault_Sample_Size(stream.ReadBigEndianUInt32());
-        this->SetDefault_Sample_Flags(stream.ReadBigEndianUInt32());
+        BinaryDataReader::Dispatch
+        (
+            stream,
+            [ & ]( auto & reader )
+            {
+                this->SetTrack_ID( reader.ReadBigEndianUInt32() );
+                this->SetDefault_Sample_Description_Index(reader.ReadBigEndianUInt32());
+                this->SetDefault_Sample_Duration(reader.ReadBigEndianUInt32());
+                this->SetDefault_Sample_Size(reader.ReadBigEndianUInt32());
+                this->SetDefault_Sample_Flags(reader.ReadBigEndianUInt32());
+            }
+        );
     }
 
     uint32_t    TREX::GetTrack_ID()  const
     {
+        this->Load();
+        
         return this->impl->_track_ID;
     }
     uint32_t    TREX::GetDefault_Sample_Description_Index()  const
     {
+        this->Load();
+        
         return this->impl->_default_sample_description_index;
     }
     uint32_t    TREX::GetDefault_Sample_Duration()  const
     {
+        this->Load();
+        
         return this->impl->_default_sample_duration;
     }
     uint32_t    TREX::GetDefault_Sample_Size()  const
     {
+        this->Load();
+        
         return this->impl->_default_sample_size;
     }
     uint32_t    TREX::GetDefault_Sample_Flags()  const
     {
+        this->Load();
+        
         return this->impl->_default_sample_flags;
     }
 
     void        TREX::SetTrack_ID(uint32_t value)
     {
+        this->Load();
+        
         this->impl->_track_ID = value;
     }
     void        TREX::SetDefault_Sample_Description_Index(uint32_t value)
     {
+        this->Load();
+        
         this->impl->_default_sample_description_index = value;
     }
     void        TREX::SetDefault_Sample_Duration(uint32_t value)
     {
+        this->Load();
+        
         this->impl->_default_sample_duration = value;
     }
     void        TREX::SetDefault_Sample_Size(uint32_t value)
     {
+        this->Load();
+        
         this->impl->_default_sample_size = value;
     }
     void        TREX::SetDefault_Sample_Flags(uint32_t value)
     {
+        this->Load();
+        
         this->impl->_default_sample_flags = value;
     }
 
@@ -0,0 +1,363 @@
+/*******************************************************************************
+ * The MIT License (MIT)
+ * 
+ * Copyright (c) 2017 DigiDNA - www.digidna.net
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ ******************************************************************************/
+
+/*!
+ * @file        ThumbnailReader.cpp
+ * @copyright   (c) 2017, DigiDNA - www.digidna.net
+ * @author      Jean-David Gadina - www.digidna.net
+ */
+
+#include <ISOBMFF/ThumbnailReader.hpp>
+#include <ISOBMFF/Parser.hpp>
+#include <ISOBMFF/File.hpp>
+#include <ISOBMFF/META.hpp>
+#include <ISOBMFF/ISPE.hpp>
+#include <ISOBMFF/FourCC.hpp>
+#include <ISOBMFF/ItemIndex.hpp>
+#include <ISOBMFF/ItemDataReader.hpp>
+#include <ISOBMFF/BoxLayout.hpp>
+#include <ISOBMFF/BinaryDataStream.hpp>
+#include <ISOBMFF/BinaryDataReader.hpp>
+#include <ISOBMFF/BinaryFileStream.hpp>
+#include <ISOBMFF/Casts.hpp>
+#include <stdexcept>
+
+namespace ISOBMFF
+{
+    class ThumbnailReader::IMPL
+    {
+        public:
+            
+            IMPL();
+            IMPL( const IMPL & o );
+            ~IMPL();
+            
+            void Load( const std::shared_ptr< BinaryStream > & stream );
+            
+            uint32_t                _primaryItemID;
+            uint32_t                _itemID;
+            std::string             _itemType;
+            uint32_t                _width;
+            uint32_t                _height;
+            std::shared_ptr< HVCC > _hvcc;
+            ItemDataReader          _reader;
+    };
+    
+    ThumbnailReader::ThumbnailReader():
+        impl( std::make_unique< IMPL >() )
+    {}
+    
+    ThumbnailReader::ThumbnailReader( const std::string & path ):
+        impl( std::make_unique< IMPL >() )
+    {
+        /* Only positional reads are used, so no read-ahead buffer is needed */
+        this->impl->Load( std::make_shared< BinaryFileStream >( path, 0 ) );
+    }
+    
+    ThumbnailReader::ThumbnailReader( const std::shared_ptr< BinaryStream > & stream ):
+        impl( std::make_unique< IMPL >() )
+    {
+        this->impl->Load( stream );
+    }
+    
+    ThumbnailReader::ThumbnailReader( const ThumbnailReader & o ):
+        impl( std::make_unique< IMPL >( *( o.impl ) ) )
+    {}
+    
+    ThumbnailReader::ThumbnailReader( ThumbnailReader && o ) noexcept:
+        impl( std::move( o.impl ) )
+    {
+        o.impl = nullptr;
+    }
+    
+    ThumbnailReader::~ThumbnailReader()
+    {}
+    
+    ThumbnailReader & ThumbnailReader::operator =( ThumbnailReader o )
+    {
+        swap( *( this ), o );
+        
+        return *( this );
+    }
+    
+    void swap( ThumbnailReader & o1, ThumbnailReader & o2 )
+    {
+        using std::swap;
+        
+        swap( o1.impl, o2.impl );
+    }
+    
+    bool ThumbnailReader::HasThumbnail() const
+    {
+        return this->impl->_itemID != 0;
+    }
+    
+    uint32_t ThumbnailReader::GetPrimaryItemID() const
+    {
+        return this->impl->_primaryItemID;
+    }
+    
+    uint32_t ThumbnailReader::GetItemID() const
+    {
+        return this->impl->_itemID;
+    }
+    
+    std::string ThumbnailReader::GetItemType() const
+    {
+        return this->impl->_itemType;
+    }
+    
+    uint32_t ThumbnailReader::GetWidth() const
+    {
+        return this->impl->_width;
+    }
+    
+    uint32_t ThumbnailReader::GetHeight() const
+    {
+        return this->impl->_height;
+    }
+    
+    std::shared_ptr< HVCC > ThumbnailReader::GetHVCC() const
+    {
+        return this->impl->_hvcc;
+    }
+    
+    std::vector< uint8_t > ThumbnailReader::GetData() const
+    {
+        if( this->HasThumbnail() == false )
+        {
+            return {};
+        }
+        
+        return this->impl->_reader.GetData( this->impl->_itemID );
+    }
+    
+    std::vector< uint8_t > ThumbnailReader::GetBitstream() const
+    {
+        static const uint8_t   startCode[ 4 ] = { 0, 0, 0, 1 };
+        std::vector< uint8_t > data;
+        std::vector< uint8_t > bitstream;
+        size_t                 lengthSize;
+        size_t                 offset;
+        
+        data = this->GetData();
+        
+        if( this->impl->_hvcc == nullptr || data.size() == 0 )
+        {
+            return data;
+        }
+        
+        bitstream.reserve( data.size() + 256 );
+        
+        for( const auto & array: this->impl->_hvcc->GetArrays() )
+        {
+            for( const auto & unit: array->GetNALUnits() )
+            {
+                DataView view( unit->GetDataView() );
+                
+                bitstream.insert( bitstream.end(), startCode, startCode + 4 );
+                bitstream.insert( bitstream.end(), view.GetBytes(), view.GetBytes() + view.GetSize() );
+            }
+        }
+        
+        lengthSize = static_cast< size_t >( this->impl->_hvcc->GetLengthSizeMinusOne() ) + 1;
+        
+        /* Length size of 3 is not allowed by ISO/IEC 14496-15 */
+        if( lengthSize != 1 && lengthSize != 2 && lengthSize != 4 )
+        {
+            throw std::runtime_error( "Invalid hvcC NAL unit length size" );
+        }
+        
+        for( offset = 0; data.size() - offset >= lengthSize; )
+        {
+            BinaryDataReader reader( data.data() + offset, lengthSize );
+            uint64_t         length;
+            
+            if( lengthSize == 1 )
+            {
+                length = reader.ReadUInt8();
+            }
+            else if( lengthSize == 2 )
+            {
+                length = reader.ReadBigEndianUInt16();
+            }
+            else
+            {
+                length = reader.ReadBigEndianUInt32();
+            }
+            
+            offset += lengthSize;
+            
+            if( length > data.size() - offset )
+            {
+                throw std::runtime_error( "Invalid thumbnail data - NAL unit length out of bounds" );
+            }
+            
+            bitstream.insert( bitstream.end(), startCode, startCode + 4 );
+            bitstream.insert( bitstream.end(), data.data() + offset, data.data() + offset + length );
+            
+            offset += length;
+        }
+        
+        return bitstream;
+    }
+    
+    ThumbnailReader::IMPL::IMPL():
+        _primaryItemID( 0 ),
+        _itemID( 0 ),
+        _width( 0 ),
+        _height( 0 )
+    {}
+    
+    ThumbnailReader::IMPL::IMPL( const IMPL & o ):
+        _primaryItemID( o._primaryItemID ),
+        _itemID( o._itemID ),
+        _itemType( o._itemType ),
+        _width( o._width ),
+        _height( o._height ),
+        _hvcc( o._hvcc ),
+        _reader( o._reader )
+    {}
+    
+    ThumbnailReader::IMPL::~IMPL()
+    {}
+    
+    void ThumbnailReader::IMPL::Load( const std::shared_ptr< BinaryStream > & stream )
+    {
+        uint64_t                end;
+        uint64_t                offset;
+        uint64_t                size;
+        uint64_t                ftypOffset;
+        uint64_t                ftypSize;
+        uint64_t                metaOffset;
+        uint64_t                metaSize;
+        std::vector< uint8_t >  data;
+        Parser                  parser;
+        std::shared_ptr< META > meta;
+        std::vector< uint32_t > thumbnails;
+        std::shared_ptr< ISPE > ispe;
+        
+        if( stream == nullptr )
+        {
+            throw std::runtime_error( "Invalid stream" );
+        }
+        
+        end        = stream->Size();
+        ftypOffset = 0;
+        ftypSize   = 0;
+        metaOffset = 0;
+        metaSize   = 0;
+        
+        /* Only the top-level box headers are read, until both boxes are found */
+        for( offset = 0; end - offset >= 8 && ( ftypSize == 0 || metaSize == 0 ); offset += size )
+        {
+            BoxLayout::Entry entry( BoxLayout::ReadEntry( *( stream ), offset, end, 0 ) );
+            
+            if( entry.IsTruncated() )
+            {
+                throw std::runtime_error( "Invalid box size - Box extends past the end of the file" );
+            }
+            
+            size = entry.GetSize();
+            
+            if( entry.GetType() == FourCC( "ftyp" ) && ftypSize == 0 )
+            {
+                ftypOffset = offset;
+                ftypSize   = size;
+            }
+            else if( entry.GetType() == FourCC( "meta" ) && metaSize == 0 )
+            {
+                metaOffset = offset;
+                metaSize   = size;
+            }
+        }
+        
+        if( ftypSize == 0 )
+        {
+            throw std::runtime_error( "File has no ftyp box" );
+        }
+        
+        if( metaSize == 0 )
+        {
+            throw std::runtime_error( "File has no meta box" );
+        }
+        
+        /*
+         * Both boxes are parsed from memory, with the ftyp box first, as
+         * expected by the parser. They usually follow each other, and are
+         * then read at once.
+         */
+        data.resize( numeric_cast< size_t >( ftypSize + metaSize ) );
+        
+        if( ftypOffset + ftypSize == metaOffset )
+        {
+            stream->ReadAt( ftypOffset, data.data(), data.size() );
+        }
+        else
+        {
+            stream->ReadAt( ftypOffset, data.data(), numeric_cast< size_t >( ftypSize ) );
+            stream->ReadAt( metaOffset, data.data() + ftypSize, numeric_cast< size_t >( metaSize ) );
+        }
+        
+        /* Retained by the boxes, so views on their data remain valid */
+        parser.Parse( std::make_shared< BinaryDataStream >( data ) );
+        
+        meta = parser.GetFile()->GetTypedBox< META >( "meta" );
+        
+        if( meta == nullptr )
+        {
+            throw std::runtime_error( "Invalid meta box" );
+        }
+        
+        ItemIndex index( *( meta ) );
+        
+        this->_primaryItemID = index.GetPrimaryItemID();
+        
+        if( this->_primaryItemID == 0 )
+        {
+            return;
+        }
+        
+        /* Thumbnails reference the image they represent */
+        thumbnails = index.GetReferencingItems( this->_primaryItemID, FourCC( "thmb" ) );
+        
+        if( thumbnails.size() == 0 )
+        {
+            return;
+        }
+        
+        /* Item locations are absolute, so they are read from the file's stream */
+        this->_reader   = ItemDataReader( *( meta ), stream );
+        this->_itemID   = thumbnails[ 0 ];
+        this->_itemType = index.GetItemType( this->_itemID );
+        this->_hvcc     = index.GetTypedProperty< HVCC >( this->_itemID, FourCC( "hvcC" ) );
+        ispe            = index.GetTypedProperty< ISPE >( this->_itemID, FourCC( "ispe" ) );
+        
+        if( ispe != nullptr )
+        {
+            this->_width  = ispe->GetDisplayWidth();
+            this->_height = ispe->GetDisplayHeight();
+        }
+    }
+}